@@ -0,0 +1,23 @@
+// ===== include/core/AllocationPolicy.hpp =====
+#pragma once
+
+// Politiques d'allocation d'un ordre entrant entre les ordres d'un même
+// niveau de prix. Le matcher est instancié pour chacune (paramètre de
+// template) : l'instance FIFO ne contient aucun test sur la politique.
+struct FifoAllocation {
+    static constexpr bool kProRata = false;
+    static constexpr bool kTopOrderPriority = false;
+};
+
+// Au prorata des quantités visibles ; le reliquat d'arrondi est attribué
+// dans l'ordre de la file
+struct ProRataAllocation {
+    static constexpr bool kProRata = true;
+    static constexpr bool kTopOrderPriority = false;
+};
+
+// L'ordre en tête de file est servi en priorité, le reste au prorata
+struct TopOrderProRataAllocation {
+    static constexpr bool kProRata = true;
+    static constexpr bool kTopOrderPriority = true;
+};
@@ -3,14 +3,20 @@
 #include "core/PriceLevel.hpp"
 #include <map>
 #include <memory>
+#include <memory_resource>
 
 template<typename Comparator>
 class BookSide {
 private:
-    std::map<Price, std::unique_ptr<PriceLevel>, Comparator> levels_;
+    // Niveaux stockés par valeur : les nœuds de la map et les tableaux de
+    // chaque PriceLevel sont alloués dans la memory_resource du carnet
+    std::pmr::map<Price, PriceLevel, Comparator> levels_;
     
 public:
-    BookSide() = default;
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+    using Compare = Comparator;  // Ordre des niveaux : meilleur prix en tête
+    
+    explicit BookSide(const allocator_type& alloc = {}) : levels_(alloc) {}
     
     void addOrder(OrderPtr order) {
         // IMPORTANT: Les ordres MARKET ne doivent JAMAIS être ajoutés au carnet
@@ -19,29 +25,33 @@ public:
         }
         
         Price price = order->getPrice();
-        auto it = levels_.find(price);
-        
-        if (it == levels_.end()) {
-            auto level = std::make_unique<PriceLevel>(price);
-            level->addOrder(order);
-            levels_[price] = std::move(level);
-        } else {
-            it->second->addOrder(order);
-        }
+        auto it = levels_.try_emplace(price, price).first;
+        it->second.addOrder(std::move(order));
     }
     
     void removeOrder(OrderId orderId, Price price) {
         auto it = levels_.find(price);
         if (it != levels_.end()) {
-            it->second->removeOrder(orderId);
-            if (it->second->isEmpty()) {
+            it->second.removeOrder(orderId);
+            if (it->second.isEmpty()) {
                 levels_.erase(it);
             }
         }
     }
     
+    void reduceOrder(OrderId orderId, Price price) {
+        auto it = levels_.find(price);
+        if (it != levels_.end()) {
+            it->second.reduceOrder(orderId);
+        }
+    }
+    
     PriceLevel* getBestLevel() {
-        return levels_.empty() ? nullptr : levels_.begin()->second.get();
+        return levels_.empty() ? nullptr : &levels_.begin()->second;
+    }
+    
+    const PriceLevel* getBestLevel() const {
+        return levels_.empty() ? nullptr : &levels_.begin()->second;
     }
     
     Price getBestPrice() const {
@@ -49,9 +59,16 @@ public:
     }
     
     bool isEmpty() const { return levels_.empty(); }
+    size_t getLevelCount() const { return levels_.size(); }
     
     auto begin() { return levels_.begin(); }
     auto end() { return levels_.end(); }
+    auto begin() const { return levels_.begin(); }
+    auto end() const { return levels_.end(); }
+    
+    // Supprime un niveau vidé par le matching, renvoie le niveau suivant
+    template<typename Iterator>
+    auto eraseLevel(Iterator it) { return levels_.erase(it); }
 };
 
 using BidSide = BookSide<std::greater<Price>>;
@@ -0,0 +1,151 @@
+// ===== include/core/BookView.hpp =====
+#pragma once
+#include "types/Enums.hpp"
+#include "types/OrderTypes.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+class Order;
+class OrderBook;
+
+struct BookViewConfig {
+    size_t depth = 10;             // Niveaux publiés par côté
+    size_t orderSlots = 1 << 16;   // Table des ordres (arrondie à une puissance de 2)
+};
+
+// Meilleur niveau de chaque côté (prix 0 si le côté est vide)
+struct TopOfBook {
+    uint64_t version = 0;          // Numéro de publication, commun avec DepthView
+    Price bidPrice = 0;
+    Quantity bidQuantity = 0;
+    size_t bidOrders = 0;
+    Price askPrice = 0;
+    Quantity askQuantity = 0;
+    size_t askOrders = 0;
+    Price lastTradePrice = 0;
+};
+
+struct LevelView {
+    Price price = 0;
+    Quantity quantity = 0;         // Quantité visible du niveau
+    size_t orderCount = 0;
+};
+
+// Profondeur publiée : meilleurs niveaux en tête
+struct DepthView {
+    uint64_t version = 0;
+    std::vector<LevelView> bids;
+    std::vector<LevelView> asks;
+};
+
+struct OrderView {
+    OrderId orderId = 0;
+    Side side = Side::BUY;
+    OrderType type = OrderType::LIMIT;
+    OrderStatus status = OrderStatus::PENDING;
+    Price price = 0;
+    Quantity quantity = 0;
+    Quantity remainingQuantity = 0;
+    Quantity executedQuantity = 0;
+};
+
+// Vue en lecture seule d'un carnet pour des threads lecteurs (surveillance,
+// interface) pendant que le thread de matching tourne. Le moteur publie
+// après chaque action ; l'écrivain ne prend aucun verrou et n'attend jamais
+// un lecteur :
+// - meilleur niveau sous seqlock (le lecteur recommence si une
+//   publication l'a chevauché) ;
+// - profondeur dans des tampons immuables publiés par pointeur (RCU) : chaque
+//   lecteur annonce le tampon qu'il lit (pointeur de danger), l'écrivain ne
+//   réutilise que les tampons qu'aucun lecteur n'annonce ;
+// - état des ordres dans une table à adressage ouvert de capacité fixe,
+//   un seqlock par entrée. Un ordre terminé (exécuté, annulé, rejeté) reste
+//   lisible jusqu'à ce que son entrée soit reprise par un nouvel ordre. Un
+//   ordre n'est cherché que dans kProbeLimit entrées depuis sa position : si
+//   elles sont toutes occupées par des ordres actifs, il n'est pas publié
+//   (compteur de débordement).
+class BookView {
+public:
+    static constexpr size_t kMaxReaders = 16;   // Lecteurs simultanés de la profondeur
+    static constexpr size_t kProbeLimit = 32;   // Entrées examinées par ordre
+
+private:
+    struct alignas(64) TopSlot {
+        std::atomic<uint64_t> sequence{0};
+        std::atomic<uint64_t> version{0};
+        std::atomic<Price> bidPrice{0};
+        std::atomic<Quantity> bidQuantity{0};
+        std::atomic<size_t> bidOrders{0};
+        std::atomic<Price> askPrice{0};
+        std::atomic<Quantity> askQuantity{0};
+        std::atomic<size_t> askOrders{0};
+        std::atomic<Price> lastTradePrice{0};
+    };
+    
+    struct DepthBuffer {
+        DepthView view;
+    };
+    
+    struct alignas(64) ReaderSlot {
+        std::atomic<const DepthBuffer*> hazard{nullptr};  // nullptr : slot libre
+    };
+    
+    struct OrderSlot {
+        std::atomic<uint64_t> sequence{0};
+        std::atomic<OrderId> orderId{0};  // 0 : entrée jamais utilisée
+        std::atomic<uint32_t> kind{0};    // Côté, type et statut
+        std::atomic<Price> price{0};
+        std::atomic<Quantity> quantity{0};
+        std::atomic<Quantity> remainingQuantity{0};
+        std::atomic<Quantity> executedQuantity{0};
+    };
+    
+    size_t depth_;
+    TopSlot top_;
+    
+    // Tampons de profondeur : kMaxReaders lecteurs en retiennent au plus
+    // kMaxReaders, plus le courant ; l'écrivain en trouve donc toujours un libre
+    std::vector<std::unique_ptr<DepthBuffer>> buffers_;
+    std::atomic<DepthBuffer*> current_{nullptr};
+    mutable std::array<ReaderSlot, kMaxReaders> readers_;
+    
+    std::unique_ptr<OrderSlot[]> orders_;
+    size_t orderMask_;
+    size_t probeLimit_;
+    
+    // Côté écrivain
+    uint64_t version_ = 0;
+    std::atomic<uint64_t> overflow_{0};
+    
+    DepthBuffer* acquireBuffer();
+    size_t slotIndex(OrderId orderId) const;
+
+public:
+    explicit BookView(const BookViewConfig& config = {});
+    
+    BookView(const BookView&) = delete;
+    BookView& operator=(const BookView&) = delete;
+    
+    // Écrivain (thread de matching) : état du carnet après une action
+    void publishBook(const OrderBook& book);
+    // Écrivain : état courant d'un ordre
+    void publishOrder(const Order& order);
+    
+    // Lecteurs (tout thread) : copies cohérentes, sans bloquer l'écrivain
+    TopOfBook getTopOfBook() const;
+    void readDepth(DepthView& out) const;
+    DepthView getDepth() const {
+        DepthView view;
+        readDepth(view);
+        return view;
+    }
+    std::optional<OrderView> findOrder(OrderId orderId) const;
+    
+    size_t getDepthLimit() const { return depth_; }
+    uint64_t getOverflowCount() const { return overflow_.load(std::memory_order_relaxed); }
+};
@@ -0,0 +1,18 @@
+// ===== include/core/CapacityConfig.hpp =====
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Capacités attendues pour la session : servent à réserver les index et
+// tables de hachage, et à dimensionner l'arène pré-allouée (HugePageArena)
+// avant le premier ordre de la journée.
+struct CapacityConfig {
+    size_t instruments = 0;        // Nombre d'instruments attendus
+    size_t ordersPerBook = 0;      // Ordres vivants + historique par carnet
+    size_t levelsPerSide = 0;      // Niveaux de prix par côté
+    bool useHugePages = false;     // MAP_HUGETLB puis THP, repli sur pages normales
+    std::vector<std::string> symbols;  // Instruments à créer dès le démarrage (optionnel)
+    
+    bool isEnabled() const { return instruments > 0 || ordersPerBook > 0; }
+};
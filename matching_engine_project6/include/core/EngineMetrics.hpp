@@ -0,0 +1,20 @@
+// ===== include/core/EngineMetrics.hpp =====
+#pragma once
+#include "utils/Metrics.hpp"
+#include <array>
+
+// Compteurs et jauges d'un moteur, écrits par le thread de matching et lus
+// par l'export. Compteurs et jauges sont sur des lignes de cache distinctes
+// du reste du moteur.
+struct alignas(64) EngineMetrics {
+    std::array<MetricCounter, 4> ordersByAction;  // Indexé par Action (NEW, MODIFY, CANCEL, MASS_CANCEL)
+    MetricCounter fills;
+    MetricCounter rejects;
+    MetricCounter eventsEmitted;
+    
+    // Jauges publiées à la fin de chaque action
+    alignas(64) MetricCounter restingOrders;
+    MetricCounter bidLevels;
+    MetricCounter askLevels;
+    MetricCounter historySize;
+};
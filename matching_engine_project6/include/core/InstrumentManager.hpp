@@ -1,21 +1,116 @@
 // ===== include/core/InstrumentManager.hpp =====
 #pragma once
 #include "core/MatchingEngine.hpp"
+#include "core/CapacityConfig.hpp"
 #include <unordered_map>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+class JournalWriter;
+class ThreadPool;
 
 class InstrumentManager {
 private:
-    std::unordered_map<std::string, std::unique_ptr<MatchingEngine>> engines_;
+    // Moteurs stockés par valeur : construits avec l'allocateur de la map,
+    // ils héritent de sa memory_resource (nœuds stables, références valides)
+    std::pmr::unordered_map<std::string, MatchingEngine> engines_;
+    CapacityConfig capacity_;
+    JournalWriter* journal_ = nullptr;  // Write-ahead journal (optionnel, non possédé)
+    bool inAuction_ = false;            // Les moteurs créés pendant l'enchère y entrent aussi
+    RiskLimits riskLimits_;             // Appliquées à chaque moteur, existant ou futur
+    EventMode eventMode_ = EventMode::FULL;
+    std::optional<BookViewConfig> bookViews_;  // Vues des lecteurs concurrents (désactivées par défaut)
+    
+    // Moteurs vus par les lecteurs concurrents (métriques, vues du carnet) :
+    // la table des moteurs n'est parcourue que par le thread de matching, ce
+    // registre est protégé (ajout à la création d'un instrument seulement)
+    mutable std::mutex registryMutex_;
+    std::vector<std::pair<std::string_view, const MatchingEngine*>> registry_;
     
 public:
-    void processOrder(Timestamp timestamp, OrderId id,
+    explicit InstrumentManager(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    InstrumentManager(const InstrumentManager&) = delete;
+    InstrumentManager& operator=(const InstrumentManager&) = delete;
+    
+    // Motif de rejet du moteur (NONE si l'action est appliquée)
+    OrderRejection processOrder(Timestamp timestamp, OrderId id,
                      const std::string& instrument, Side side, 
                      OrderType type, Quantity quantity, 
-                     Price price, Action action);
+                     Price price, Action action, const OrderOptions& options = {});
+    
+    // Annulation de masse sur un instrument (aucun effet s'il est inconnu)
+    size_t massCancel(Timestamp timestamp, OrderId id, const std::string& instrument,
+                      const MassCancelFilter& filter);
     
     std::vector<OrderEvent> getAllEvents() const;
+    // Trades de tous les instruments (EventMode::TRADES), triés par horodatage
+    std::vector<Trade> getAllTrades() const;
+    
+    // Fin de session : expiration des ordres DAY de tous les instruments
+    void expireDayOrders();
+    
+    // Politique d'allocation d'un instrument (créé s'il n'existe pas encore)
+    void setAllocationPolicy(const std::string& instrument, AllocationPolicy policy);
+    
+    // Bande de prix et plafond de niveaux d'un instrument (créé s'il n'existe pas encore)
+    void setPriceBand(const std::string& instrument, const PriceBand& band);
+    // Fin d'entrée : fixing des instruments encore suspendus
+    void endHalts();
+    
+    // Mode des événements d'exécution de tous les instruments, existants ou futurs
+    void setEventMode(EventMode mode);
+    
+    // Vue en lecture seule du carnet de tous les instruments, existants ou
+    // futurs (à activer avant de lancer les lecteurs)
+    void enableBookViews(const BookViewConfig& config = {});
+    // Vue d'un instrument, appelable depuis un autre thread (nullptr si
+    // l'instrument est inconnu ou les vues désactivées)
+    const BookView* findBookView(std::string_view instrument) const;
+    
+    // Contrôles pré-trade de tous les instruments (positions et notionnels par instrument)
+    void setRiskLimits(const RiskLimits& limits);
+    
+    // Enchère sur tous les instruments
+    void startAuction();
+    bool isInAuction() const { return inAuction_; }
+    // Fixing de tous les instruments : les moteurs sont indépendants et sont
+    // traités en parallèle sur `pool` si fourni et si la memory_resource
+    // partagée est thread-safe (sinon séquentiellement). Renvoie le volume total.
+    Quantity uncrossAll(Timestamp timestamp, ThreadPool* pool = nullptr);
+    
+    // Chaque action est journalisée avant d'être appliquée au moteur
+    void setJournal(JournalWriter* journal) { journal_ = journal; }
+    
+    // Mode pré-allocation : réserve la table des moteurs, crée les instruments
+    // connus et pré-dimensionne chaque moteur (existant ou créé plus tard)
+    void reserve(const CapacityConfig& config);
+    
+    // Taille d'arène à pré-allouer pour tenir la configuration sans repli
+    static size_t estimateArenaBytes(const CapacityConfig& config);
+    
+    std::pmr::memory_resource* getMemoryResource() const { return engines_.get_allocator().resource(); }
     
-private:
     MatchingEngine& getOrCreateEngine(const std::string& instrument);
+    size_t getEngineCount() const { return engines_.size(); }
+    
+    // Métriques de chaque instrument, appelable depuis un autre thread
+    template<typename Fn>
+    void forEachMetrics(Fn&& fn) const {
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        for (const auto& [instrument, engine] : registry_) {
+            fn(instrument, engine->getMetrics());
+        }
+    }
+    
+    template<typename Fn>
+    void forEachEngine(Fn&& fn) const {
+        for (const auto& [instrument, engine] : engines_) {
+            fn(instrument, engine);
+        }
+    }
 };
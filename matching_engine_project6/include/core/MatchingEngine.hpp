@@ -1,27 +1,177 @@
 // =====include/core/MatchingEngine.hpp =====
 #pragma once
+#include "core/BookView.hpp"
+#include "core/EngineMetrics.hpp"
 #include "core/OrderBook.hpp"
+#include "core/OrderMatcher.hpp"
+#include "core/RiskChecker.hpp"
 #include "core/OrderEvent.hpp"
 #include "core/Trade.hpp"
+#include <array>
 #include <memory>
+#include <memory_resource>
 #include <vector>
 #include <unordered_map>
 
 class MatchingEngine {
 private:
     OrderBook orderBook_;
-    std::vector<OrderEvent> events_;  // Remplace executedTrades_
-    std::unordered_map<OrderId, OrderPtr> orderHistory_;
+    std::pmr::vector<OrderEvent> events_;  // Remplace executedTrades_
+    std::pmr::unordered_map<OrderId, OrderPtr> orderHistory_;
+    std::pmr::vector<Trade> trades_;       // Buffer de trades réutilisé à chaque ordre
+    std::pmr::vector<OrderPtr> selfTradeAdjusted_;  // Ordres au repos touchés par la prévention d'auto-exécution
+    std::pmr::vector<OrderPtr> dayOrders_;          // Ordres DAY mis au carnet depuis le début du jour
+    std::pmr::vector<OrderPtr> massCanceled_;       // Buffer réutilisé des annulations de masse
+    std::pmr::vector<Trade> tradeLog_;              // Trades de la session (EventMode::TRADES)
+    EventMode eventMode_ = EventMode::FULL;
+    RiskChecker risk_;                              // Contrôles pré-trade (désactivés par défaut)
+    Timestamp dayEnd_ = 0;                          // Début du jour UTC suivant (ns)
+    TradingPhase phase_ = TradingPhase::CONTINUOUS;
+    Timestamp haltEnd_ = 0;                         // Fin de la suspension de volatilité (0 = aucune)
+    std::array<uint64_t, kOrderRejectionCount> rejectCounts_{};  // Rejets par motif
+    EngineMetrics metrics_;
+    std::unique_ptr<BookView> view_;                // Vue des lecteurs concurrents (optionnelle)
+    size_t viewEventIndex_ = 0;                     // Événements et trades déjà reportés dans la vue
+    size_t viewTradeIndex_ = 0;
+    uint64_t eventsDiscarded_ = 0;                  // Événements libérés par discardEvents
+    
+    // Événement REJECTED et compteur du motif ; renvoie le motif
+    OrderRejection reject(Timestamp actionTimestamp, OrderId id, Side side, OrderType type,
+                          Quantity quantity, Price price, Action action, OrderRejection reason);
+    
+    // Matching de l'ordre (ou simple mise au carnet pendant une enchère)
+    void placeOrder(const OrderPtr& order);
+    // Événements d'exécution des trades_ (action MODIFY pour modifiedId)
+    void emitTradeEvents(Timestamp actionTimestamp, OrderId modifiedId = 0);
+    // Événement d'exécution de `order` (quantité et prix du ou des fills)
+    void emitFillEvent(Timestamp actionTimestamp, const OrderPtr& order, Quantity quantity,
+                       Price price, OrderId counterpartyId, OrderId modifiedId);
+    void emitCancelEvents(Timestamp actionTimestamp, const OrderPtr& order, Action action);
+    void emitTriggeredEvents(Timestamp actionTimestamp);
+    // Exposition ouverte du compte de l'ordre alignée sur son état courant
+    void trackRisk(const OrderPtr& order) {
+        if (risk_.isEnabled()) risk_.reconcile(*order);
+    }
+    // État lu par les autres threads après une action : jauges des métriques
+    // (carnet, historique, événements) et vue du carnet si activée
+    void publishState() {
+        metrics_.restingOrders.set(orderBook_.getOrderCount());
+        metrics_.bidLevels.set(orderBook_.getBids().getLevelCount());
+        metrics_.askLevels.set(orderBook_.getAsks().getLevelCount());
+        metrics_.historySize.set(orderHistory_.size());
+        metrics_.eventsEmitted.set(eventsDiscarded_ + events_.size());
+        if (view_) publishView();
+    }
+    // Ordres touchés depuis la dernière publication (événements et trades),
+    // puis meilleur niveau et profondeur
+    void publishView();
+    // Expiration des ordres DAY au premier horodatage du jour suivant
+    void advanceDay(Timestamp actionTimestamp);
+    // Balayage arrêté par la bande de prix : suspension (enchère) si configurée
+    void checkBandBreach(Timestamp actionTimestamp);
+    // Fixing de fin de suspension au premier horodatage qui la dépasse
+    void advanceHalt(Timestamp actionTimestamp) {
+        if (haltEnd_ != 0 && actionTimestamp >= haltEnd_) uncross(haltEnd_);
+    }
     
 public:
-    explicit MatchingEngine(const std::string& instrument);
+    // Tous les conteneurs du moteur (carnet, index, niveaux, événements,
+    // ordres) allouent dans la memory_resource de l'allocateur fourni
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+    
+    explicit MatchingEngine(std::string_view instrument, const allocator_type& alloc = {});
     
-    void processOrder(Timestamp actionTimestamp, OrderId id,
+    // `options` (propriétaire, prévention d'auto-exécution) n'est lu que pour NEW.
+    // Une action invalide (ordre inconnu, quantité ou prix invalide, refus de
+    // phase ou de risque) ne lève pas d'exception : elle produit un événement
+    // REJECTED et renvoie son motif (NONE si l'action est appliquée)
+    OrderRejection processOrder(Timestamp actionTimestamp, OrderId id,
                      Side side, OrderType type, 
                      Quantity quantity, Price price, 
-                     Action action);
+                     Action action, const OrderOptions& options = {});
+    
+    // Annule en bloc les ordres au carnet (et les stops) couverts par le
+    // filtre, avec un événement CANCELED chacun. Renvoie le nombre d'ordres.
+    // Via processOrder, MASS_CANCEL ne vise que le côté `side`
+    size_t massCancel(Timestamp actionTimestamp, const MassCancelFilter& filter);
+    
+    // Annule les ordres DAY encore au carnet (fin de journée)
+    void expireDayOrders();
+    
+    // Enchère d'ouverture ou de clôture : les ordres LIMIT (et stops)
+    // s'accumulent sans matching ; MARKET, IOC et FOK sont refusés
+    // (une enchère de séance remplace une suspension en cours)
+    void startAuction() { phase_ = TradingPhase::AUCTION; haltEnd_ = 0; }
+    // Fixing : exécution en bloc au prix d'équilibre, retour au continu
+    AuctionResult uncross(Timestamp actionTimestamp);
+    TradingPhase getPhase() const { return phase_; }
+    
+    // Bande de prix et plafond de niveaux des balayages (désactivés par
+    // défaut). Une suspension de volatilité est une enchère terminée par un
+    // fixing au premier ordre reçu après haltDuration.
+    void setPriceBand(const PriceBand& band) { orderBook_.setPriceBand(band); }
+    bool isHalted() const { return haltEnd_ != 0; }
+    Timestamp getHaltEnd() const { return haltEnd_; }
+    // Fin d'entrée : fixing d'une suspension encore en cours, à son échéance
+    void endHalt() { if (haltEnd_ != 0) uncross(haltEnd_); }
+    
+    // Contrôles pré-trade : un NEW ou un MODIFY (hors baisse sur place) hors
+    // limites produit un événement REJECTED au lieu d'être traité
+    void setRiskLimits(const RiskLimits& limits);
+    const RiskChecker& getRisk() const { return risk_; }
+    
+    // Compteurs et jauges lisibles depuis un autre thread (export des métriques)
+    const EngineMetrics& getMetrics() const { return metrics_; }
+    
+    // Vue en lecture seule du carnet pour d'autres threads, publiée après
+    // chaque action (désactivée par défaut). L'activation publie l'état courant.
+    void enableBookView(const BookViewConfig& config = {});
+    const BookView* getBookView() const { return view_.get(); }
+    
+    uint64_t getRejectCount(OrderRejection reason) const {
+        return rejectCounts_[static_cast<size_t>(reason)];
+    }
+    // Restauration de snapshot : position exécutée d'un compte
+    void restorePosition(OwnerId owner, int64_t position) { risk_.restorePosition(owner, position); }
+    
+    // Événements d'exécution (FULL par défaut). AGGREGATED remplace les
+    // événements de l'agresseur par un résumé par niveau de prix traversé
+    // (contrepartie 0 s'il couvre plusieurs fills) ; TRADES ne produit plus
+    // d'événement d'exécution et enregistre les trades dans getTrades().
+    // Les fixings d'enchère, sans agresseur, restent en FULL sauf en TRADES.
+    void setEventMode(EventMode mode) { eventMode_ = mode; }
+    EventMode getEventMode() const { return eventMode_; }
+    
+    // Allocation intra-niveau de l'instrument (FIFO par défaut)
+    void setAllocationPolicy(AllocationPolicy policy) { orderBook_.setAllocationPolicy(policy); }
     
     const OrderBook& getOrderBook() const { return orderBook_; }
-    const std::vector<OrderEvent>& getEvents() const { return events_; }
+    const std::pmr::vector<OrderEvent>& getEvents() const { return events_; }
+    // Mode serveur : libère les événements et trades déjà transmis (les
+    // compteurs des métriques restent cumulés)
+    void discardEvents();
+    // Trades horodatés par l'action qui les a produits (vues sur l'instrument du carnet)
+    const std::pmr::vector<Trade>& getTrades() const { return tradeLog_; }
     OrderPtr getOrder(OrderId id) const;
+    const std::pmr::unordered_map<OrderId, OrderPtr>& getOrderHistory() const { return orderHistory_; }
+    
+    // Pré-dimensionne index, historique et événements (mode pré-allocation)
+    void reserve(size_t orders);
+    
+    // Restauration de snapshot : dernier prix échangé (référence des stops)
+    void restoreLastTradePrice(Price price) { orderBook_.setLastTradePrice(price); }
+    // Restauration de snapshot : phase et fin de suspension (0 = aucune)
+    void restorePhase(TradingPhase phase, Timestamp haltEnd) { phase_ = phase; haltEnd_ = haltEnd; }
+    
+    // Restauration de snapshot : ni matching ni événement. Un ordre actif est
+    // ajouté en fin de file de son niveau de prix, un ordre terminé ne
+    // retourne que dans l'historique. visibleQuantity : tranche iceberg en
+    // cours (0 = tranche pleine)
+    void restoreOrder(Timestamp timestamp, OrderId id, Side side, OrderType type,
+                      Quantity quantity, Price price, Quantity remainingQuantity,
+                      Quantity executedQuantity, Price executionPrice,
+                      OrderId counterpartyId, OrderStatus status,
+                      const OrderOptions& options = {}, Quantity visibleQuantity = 0);
+    
+    std::pmr::memory_resource* getMemoryResource() const { return events_.get_allocator().resource(); }
 };
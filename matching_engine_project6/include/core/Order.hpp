@@ -1,14 +1,17 @@
 #pragma once
 #include "types/OrderTypes.hpp"
 #include "types/Enums.hpp"
+#include "types/OrderOptions.hpp"
 #include <memory>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 
 class Order {
 private:
     Timestamp timestamp_;
     OrderId orderId_;
-    std::string instrument_;
+    std::pmr::string instrument_;
     Side side_;
     OrderType type_;
     Quantity quantity_;
@@ -18,15 +21,29 @@ private:
     Price executionPrice_;
     OrderStatus status_;
     OrderId counterpartyId_;
+    OrderOptions options_;
+    Quantity visibleQuantity_;  // Iceberg : reste de la tranche visible
+    Quantity riskQuantity_ = 0; // Exposition ouverte déjà comptée par le RiskChecker
+    Price riskPrice_ = 0;
 
 public:
-    Order(Timestamp ts, OrderId id, std::string instrument, 
-          Side side, OrderType type, Quantity qty, Price price);
+    // Allocator-aware : std::allocate_shared avec un polymorphic_allocator
+    // place l'ordre et son instrument dans la même memory_resource
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+    
+    Order(Timestamp ts, OrderId id, std::string_view instrument, 
+          Side side, OrderType type, Quantity qty, Price price,
+          const allocator_type& alloc = {});
+    
+    // Contrôles du constructeur sans exception : le moteur rejette les
+    // ordres invalides avant de les construire
+    static OrderRejection validate(OrderId id, std::string_view instrument, OrderType type,
+                                   Quantity qty, Price price);
     
     // Getters inline pour performance
     inline Timestamp getTimestamp() const { return timestamp_; }
     inline OrderId getOrderId() const { return orderId_; }
-    inline const std::string& getInstrument() const { return instrument_; }
+    inline const std::pmr::string& getInstrument() const { return instrument_; }
     inline Side getSide() const { return side_; }
     inline OrderType getType() const { return type_; }
     inline Quantity getQuantity() const { return quantity_; }
@@ -36,11 +53,38 @@ public:
     inline Price getExecutionPrice() const { return executionPrice_; }
     inline OrderStatus getStatus() const { return status_; }
     inline OrderId getCounterpartyId() const { return counterpartyId_; }
+    inline const OrderOptions& getOptions() const { return options_; }
+    inline OwnerId getOwner() const { return options_.owner; }
+    inline SelfTradePrevention getSelfTradePrevention() const { return options_.selfTradePrevention; }
+    inline TimeInForce getTimeInForce() const { return options_.timeInForce; }
+    inline bool isIceberg() const { return options_.displayQuantity > 0; }
+    // Ordre stop en attente de déclenchement (le stop est effacé au déclenchement)
+    inline bool isStop() const { return options_.stopPrice > 0; }
+    inline Price getStopPrice() const { return options_.stopPrice; }
+    void trigger() { options_.stopPrice = 0; }
+    // Quantité affichée au carnet (la tranche courante pour un iceberg)
+    inline Quantity getVisibleQuantity() const {
+        return isIceberg() ? visibleQuantity_ : remainingQuantity_;
+    }
+    
+    inline Quantity getRiskQuantity() const { return riskQuantity_; }
+    inline Price getRiskPrice() const { return riskPrice_; }
+    void setRiskExposure(Quantity quantity, Price price) { riskQuantity_ = quantity; riskPrice_ = price; }
+    
+    void setOptions(const OrderOptions& options);
+    // Iceberg : nouvelle tranche visible prélevée sur la réserve
+    Quantity replenish();
     
     void updateQuantity(Quantity newQty);
     void updatePrice(Price newPrice);
     void execute(Quantity executedQty, Price execPrice, OrderId counterparty);
     void cancel();
+    // Réduction sans exécution (prévention d'auto-exécution) : terminé à 0
+    void decrement(Quantity qty);
+    // Restauration de snapshot : réapplique l'état d'exécution tel quel
+    // (visible = 0 : tranche iceberg pleine)
+    void restoreState(Quantity remaining, Quantity executed, Price execPrice,
+                      OrderId counterparty, OrderStatus status, Quantity visible = 0);
     
     bool isActive() const { 
         return status_ == OrderStatus::PENDING || status_ == OrderStatus::PARTIALLY_EXECUTED; 
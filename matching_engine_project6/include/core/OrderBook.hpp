@@ -2,27 +2,119 @@
 // ===== include/core/OrderBook.hpp =====
 #pragma once
 #include "core/BookSide.hpp"
+#include "core/StopBook.hpp"
+#include "types/OrderOptions.hpp"
 #include <unordered_map>
+#include <memory_resource>
 #include <string>
+#include <limits>
+
+// Protection des balayages d'un instrument : bande de prix autour d'une
+// référence (dernier prix échangé, sinon meilleur prix opposé) et plafond du
+// nombre de niveaux consommés par un ordre. Le reliquat d'un ordre arrêté est
+// annulé ; le franchissement de la bande peut suspendre l'instrument.
+struct PriceBand {
+    double percent = 0;          // Largeur relative à la référence (0.05 = 5 %)
+    Price width = 0;             // Largeur absolue (ticks × pas), prioritaire si > 0
+    size_t maxLevels = 0;        // Niveaux consommés par ordre (0 = sans plafond)
+    Timestamp haltDuration = 0;  // Suspension sur franchissement de la bande (0 = aucune)
+    
+    bool isEnabled() const { return percent > 0 || width > 0 || maxLevels > 0; }
+};
+
+// Bornes d'un balayage : dernier prix accessible et nombre de niveaux
+struct SweepLimit {
+    Price bound;
+    size_t maxLevels;
+};
 
 class OrderBook {
 private:
-    std::string instrument_;
+    std::pmr::string instrument_;
     BidSide bids_;
     AskSide asks_;
-    std::unordered_map<OrderId, std::pair<OrderPtr, Price>> orderIndex_;
+    std::pmr::unordered_map<OrderId, std::pair<OrderPtr, Price>> orderIndex_;
+    StopBook stops_;          // Ordres stop pas encore déclenchés
+    Price lastTradePrice_;    // 0 tant qu'aucun trade n'a eu lieu
+    AllocationPolicy allocation_ = AllocationPolicy::FIFO;
+    PriceBand band_;
+    bool bandBreached_ = false;  // Balayage arrêté par la bande, lu par le moteur
     
 public:
-    explicit OrderBook(const std::string& instrument);
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
     
+    explicit OrderBook(std::string_view instrument, const allocator_type& alloc = {});
+    
+    // Un ordre stop non déclenché va dans le carnet de déclenchement ;
+    // removeOrder et findOrder couvrent les deux carnets
     void addOrder(OrderPtr order);
     void removeOrder(OrderId orderId);
+    // Retire uniquement l'entrée d'index (le niveau de prix a déjà retiré le slot)
+    void removeFromIndex(OrderId orderId) { orderIndex_.erase(orderId); }
     OrderPtr findOrder(OrderId orderId) const;
+    // Annulation de masse : sans propriétaire, les niveaux concernés sont
+    // retirés en entier ; sinon balayage du tableau des propriétaires de
+    // chaque niveau. Les ordres annulés (stops compris) sont ajoutés à `canceled`
+    void massCancel(const MassCancelFilter& filter, std::pmr::vector<OrderPtr>& canceled);
+    // Baisse de quantité sans changement de prix : l'ordre garde sa priorité
+    // temps, seul l'agrégat du niveau est ajusté (newQty doit rester
+    // supérieure à la quantité déjà exécutée)
+    void reduceOrder(OrderId orderId, Quantity newQty);
+    
+    // Pré-dimensionne l'index pour éviter tout rehash en séance
+    void reserve(size_t orders) { orderIndex_.reserve(orders); }
     
     BidSide& getBids() { return bids_; }
     AskSide& getAsks() { return asks_; }
-    const std::string& getInstrument() const { return instrument_; }
+    const BidSide& getBids() const { return bids_; }
+    const AskSide& getAsks() const { return asks_; }
+    size_t getOrderCount() const { return orderIndex_.size(); }
+    const std::pmr::string& getInstrument() const { return instrument_; }
     
     Price getBestBid() const { return bids_.getBestPrice(); }
     Price getBestAsk() const { return asks_.getBestPrice(); }
+    
+    // Dernier prix échangé : met à jour la référence des stops et collecte
+    // ceux qui se déclenchent
+    void onTrade(Price price) {
+        lastTradePrice_ = price;
+        stops_.onTrade(price);
+    }
+    Price getLastTradePrice() const { return lastTradePrice_; }
+    void setLastTradePrice(Price price) { lastTradePrice_ = price; }  // Restauration de snapshot
+    AllocationPolicy getAllocationPolicy() const { return allocation_; }
+    void setAllocationPolicy(AllocationPolicy policy) { allocation_ = policy; }
+    
+    const PriceBand& getPriceBand() const { return band_; }
+    void setPriceBand(const PriceBand& band) { band_ = band; }
+    // Bornes d'un balayage par un ordre de ce côté, calculées une fois par
+    // ordre (bande infinie si désactivée ou sans référence)
+    SweepLimit getSweepLimit(Side side) const {
+        constexpr Price kInfinity = std::numeric_limits<Price>::infinity();
+        SweepLimit limit{side == Side::BUY ? kInfinity : -kInfinity,
+                         band_.maxLevels > 0 ? band_.maxLevels : std::numeric_limits<size_t>::max()};
+        Price reference = lastTradePrice_ > 0 ? lastTradePrice_
+                        : (side == Side::BUY ? asks_.getBestPrice() : bids_.getBestPrice());
+        if (reference <= 0 || (band_.width <= 0 && band_.percent <= 0)) return limit;
+        Price width = band_.width > 0 ? band_.width : reference * band_.percent;
+        limit.bound = side == Side::BUY ? reference + width : reference - width;
+        return limit;
+    }
+    void flagBandBreach() { bandBreached_ = true; }
+    // Lit et réarme l'indicateur de franchissement
+    bool takeBandBreach() {
+        bool breached = bandBreached_;
+        bandBreached_ = false;
+        return breached;
+    }
+    
+    StopBook& getStops() { return stops_; }
+    const StopBook& getStops() const { return stops_; }
+    
+    std::pmr::memory_resource* getMemoryResource() const { return orderIndex_.get_allocator().resource(); }
+    
+private:
+    template<typename BookSideType>
+    void cancelLevels(BookSideType& side, const MassCancelFilter& filter,
+                      std::pmr::vector<OrderPtr>& canceled);
 };
\ No newline at end of file
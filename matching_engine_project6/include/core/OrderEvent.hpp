@@ -2,12 +2,15 @@
 #pragma once
 #include "types/OrderTypes.hpp"
 #include "types/Enums.hpp"
+#include <memory>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 
 struct OrderEvent {
     Timestamp actionTimestamp;
     OrderId orderId;
-    std::string instrument;
+    std::pmr::string instrument;
     Side side;
     OrderType type;
     Quantity displayQuantity;  // 0 if EXECUTED, remaining if PARTIALLY_EXECUTED
@@ -18,10 +21,31 @@ struct OrderEvent {
     Price executionPrice;
     OrderId counterpartyId;
     
-    OrderEvent(Timestamp ts, OrderId id, const std::string& inst, Side s, 
+    // Allocator-aware : un std::pmr::vector<OrderEvent> propage sa
+    // memory_resource à la chaîne instrument de chaque événement
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+    
+    OrderEvent(Timestamp ts, OrderId id, std::string_view inst, Side s, 
+               OrderType t, Quantity qty, Price p, Action a, OrderStatus st,
+               Quantity execQty = 0, Price execPrice = 0.0, OrderId cpId = 0)
+        : OrderEvent(std::allocator_arg, allocator_type{}, ts, id, inst, s, t, qty, p,
+                     a, st, execQty, execPrice, cpId) {}
+    
+    OrderEvent(std::allocator_arg_t, const allocator_type& alloc,
+               Timestamp ts, OrderId id, std::string_view inst, Side s, 
                OrderType t, Quantity qty, Price p, Action a, OrderStatus st,
                Quantity execQty = 0, Price execPrice = 0.0, OrderId cpId = 0)
-        : actionTimestamp(ts), orderId(id), instrument(inst), side(s),
+        : actionTimestamp(ts), orderId(id), instrument(inst, alloc), side(s),
           type(t), displayQuantity(qty), price(p), action(a), status(st),
           executedQuantity(execQty), executionPrice(execPrice), counterpartyId(cpId) {}
+    
+    OrderEvent(const OrderEvent& other) = default;
+    OrderEvent(OrderEvent&& other) = default;
+    OrderEvent& operator=(const OrderEvent& other) = default;
+    OrderEvent& operator=(OrderEvent&& other) = default;
+    
+    OrderEvent(const OrderEvent& other, const allocator_type& alloc)
+        : OrderEvent(other) { instrument = std::pmr::string(other.instrument, alloc); }
+    OrderEvent(OrderEvent&& other, const allocator_type& alloc)
+        : OrderEvent(other) { instrument = std::pmr::string(std::move(other.instrument), alloc); }
 };
\ No newline at end of file
@@ -1,20 +1,80 @@
-
 // ===== include/core/OrderMatcher.hpp =====
 #pragma once
 #include "core/OrderBook.hpp"
 #include "core/Trade.hpp"
+#include "core/AllocationPolicy.hpp"
 #include <vector>
+#include <memory_resource>
+
+// Résultat du calcul de fixing d'une enchère
+struct AuctionResult {
+    Price price = 0;         // Prix d'équilibre
+    Quantity volume = 0;     // Volume exécutable (0 : le carnet ne croise pas)
+    Quantity imbalance = 0;  // Écart entre demande et offre cumulées au prix
+};
 
 class OrderMatcher {
 public:
-    static std::vector<Trade> matchOrder(OrderPtr incomingOrder, OrderBook& book);
+    static std::pmr::vector<Trade> matchOrder(OrderPtr incomingOrder, OrderBook& book);
+    
+    // Variante sans allocation : les trades sont ajoutés au buffer fourni
+    // (réutilisé d'un ordre à l'autre par le MatchingEngine). Les ordres au
+    // repos annulés ou réduits par la prévention d'auto-exécution sont
+    // ajoutés à `selfTradeAdjusted` s'il est fourni.
+    // Un ordre stop non déclenché est placé dans le carnet de déclenchement ;
+    // les stops déclenchés par les trades sont matchés ensuite en cascade
+    // (voir OrderBook::getStops().getTriggered()).
+    static void matchOrder(OrderPtr incomingOrder, OrderBook& book,
+                           std::pmr::vector<Trade>& trades,
+                           std::pmr::vector<OrderPtr>* selfTradeAdjusted = nullptr);
+    
+    // Enchère : prix d'équilibre sur les niveaux agrégés (volume exécutable
+    // maximal, puis déséquilibre minimal, puis prix le plus proche de la
+    // référence), en un seul passage sur les profondeurs cumulées de la zone
+    // de croisement. Les réserves des icebergs participent.
+    static AuctionResult computeUncross(const OrderBook& book, Price referencePrice);
+    
+    // Exécute en bloc tout le volume croisé au prix d'équilibre (priorité
+    // prix-temps de chaque côté), puis la cascade des stops déclenchés
+    static void uncross(OrderBook& book, const AuctionResult& result,
+                        std::pmr::vector<Trade>& trades,
+                        std::pmr::vector<OrderPtr>* selfTradeAdjusted = nullptr);
     
 private:
-    static std::vector<Trade> matchLimitOrder(OrderPtr order, OrderBook& book);
-    static std::vector<Trade> matchMarketOrder(OrderPtr order, OrderBook& book);
+    static void dispatch(OrderPtr order, OrderBook& book,
+                         std::pmr::vector<Trade>& trades,
+                         std::pmr::vector<OrderPtr>* selfTradeAdjusted);
+    // Choix de l'instance du matcher selon la politique d'allocation du
+    // carnet : un seul test par ordre entrant, aucun par fill
+    static void matchIncoming(OrderPtr order, OrderBook& book,
+                              std::pmr::vector<Trade>& trades,
+                              std::pmr::vector<OrderPtr>* selfTradeAdjusted);
+    template<typename Policy>
+    static void matchWithPolicy(OrderPtr order, OrderBook& book,
+                                std::pmr::vector<Trade>& trades,
+                                std::pmr::vector<OrderPtr>* selfTradeAdjusted);
+    static void matchLimitOrder(OrderPtr order, OrderBook& book,
+                                std::pmr::vector<Trade>& trades,
+                                std::pmr::vector<OrderPtr>* selfTradeAdjusted);
+    static void matchMarketOrder(OrderPtr order, OrderBook& book,
+                                 std::pmr::vector<Trade>& trades,
+                                 std::pmr::vector<OrderPtr>* selfTradeAdjusted);
+    
+    // L'ordre croise-t-il un niveau de ce prix ?
+    static bool crosses(const Order& order, Price levelPrice);
     
+    // FOK : la quantité de l'ordre peut-elle être exécutée en totalité ?
+    // Décision sans modifier le carnet, à partir des quantités agrégées des
+    // niveaux croisés (balayage des slots seulement si l'auto-exécution s'applique),
+    // dans la bande de prix et le plafond de niveaux du carnet
     template<typename BookSideType>
-    static std::vector<Trade> matchAgainstSide(OrderPtr incomingOrder, 
-                                              BookSideType& bookSide,
-                                              OrderBook& book);
-};
\ No newline at end of file
+    static bool canFillCompletely(const Order& order, const BookSideType& bookSide,
+                                  const SweepLimit& limit);
+    
+    template<typename Policy, typename BookSideType>
+    static void matchAgainstSide(OrderPtr incomingOrder, 
+                                 BookSideType& bookSide,
+                                 OrderBook& book,
+                                 std::pmr::vector<Trade>& trades,
+                                 std::pmr::vector<OrderPtr>* selfTradeAdjusted);
+};
@@ -1,28 +1,78 @@
 // ===== include/core/PriceLevel.hpp =====
 #pragma once
 #include "core/Order.hpp"
-#include <list>
+#include <vector>
+#include <memory_resource>
 #include <algorithm>
 
+// Niveau de prix en layout Struct-of-Arrays : les quantités restantes, les IDs
+// et les handles des ordres sont stockés dans des tableaux contigus indexés par
+// "slot". Un slot annulé devient une tombe (quantité 0, handle nul) et n'est
+// compacté que paresseusement. Pour un ordre iceberg, la quantité du slot est
+// la tranche visible : la réserve reste portée par l'ordre lui-même.
 class PriceLevel {
 private:
     Price price_;
-    std::list<OrderPtr> orders_;
-    Quantity totalQuantity_;
+    std::pmr::vector<Quantity> quantities_;  // Quantité visible restante par slot (0 = tombe)
+    std::pmr::vector<OrderId> ids_;          // ID par slot (0 = tombe), recherche sans déréférencement
+    std::pmr::vector<OrderPtr> orders_;      // Handle par slot (nullptr = tombe)
+    std::pmr::vector<OwnerId> owners_;       // Propriétaire par slot (0 = aucun ou tombe)
+    size_t head_;                       // Premier slot potentiellement actif
+    size_t activeCount_;
+    Quantity totalQuantity_;            // Quantité visible du niveau
+    size_t icebergCount_;               // Ordres iceberg actifs dans le niveau
     
 public:
-    explicit PriceLevel(Price price);
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+    
+    explicit PriceLevel(Price price, const allocator_type& alloc = {});
+    PriceLevel(const PriceLevel&) = delete;
+    PriceLevel& operator=(const PriceLevel&) = delete;
     
     void addOrder(OrderPtr order);
     void removeOrder(OrderId orderId);
+    // Réduit sur place la quantité du slot de l'ordre (qui garde sa place
+    // dans la file) à sa quantité visible courante
+    void reduceOrder(OrderId orderId);
     OrderPtr getFrontOrder() const;
     
+    // Nombre de slots (à partir de head) entièrement consommés par qty :
+    // renvoie le slot de fin k tel que la somme des quantités de [head, k)
+    // est <= qty et que le slot k (s'il existe) ne peut être rempli entièrement.
+    // Si `consumed` est fourni, il reçoit cette somme.
+    size_t findConsumedEnd(Quantity qty, Quantity* consumed = nullptr) const;
+    
+    // Fill partiel du slot (quantité strictement inférieure à celle du slot)
+    void fillSlot(size_t slot, Quantity qty);
+    
+    // Retire les slots [head, end) après un fill complet en bloc
+    void popFront(size_t end, Quantity filledQuantity);
+    
+    // Retire un slot quelconque sans compaction (les index des autres slots
+    // restent valides pendant un balayage) ; appeler settle() ensuite
+    void clearSlot(size_t slot);
+    void settle();
+    
+    // Premier slot de [head, end) appartenant à owner, ou end s'il n'y en a
+    // pas (balayage du seul tableau des propriétaires, sans déréférencement)
+    size_t findOwner(OwnerId owner, size_t end) const;
+    
     inline Price getPrice() const { return price_; }
     inline Quantity getTotalQuantity() const { return totalQuantity_; }
-    inline bool isEmpty() const { return orders_.empty(); }
-    inline size_t getOrderCount() const { return orders_.size(); }
+    inline bool hasIcebergs() const { return icebergCount_ > 0; }
+    // Réserve cachée des icebergs du niveau (déréférence les ordres, à
+    // n'utiliser que si hasIcebergs())
+    Quantity getHiddenQuantity() const;
+    inline bool isEmpty() const { return activeCount_ == 0; }
+    inline size_t getOrderCount() const { return activeCount_; }
     
-    // Iterator access
-    auto begin() { return orders_.begin(); }
-    auto end() { return orders_.end(); }
+    // Accès par slot (les tombes ont un handle nul)
+    inline size_t beginSlot() const { return head_; }
+    inline size_t endSlot() const { return orders_.size(); }
+    inline const OrderPtr& orderAt(size_t slot) const { return orders_[slot]; }
+    inline Quantity quantityAt(size_t slot) const { return quantities_[slot]; }
+    inline OwnerId ownerAt(size_t slot) const { return owners_[slot]; }
+    
+private:
+    void compact();
 };
@@ -0,0 +1,70 @@
+// ===== include/core/RiskChecker.hpp =====
+#pragma once
+#include "core/Order.hpp"
+#include <unordered_map>
+#include <memory_resource>
+
+class OrderBook;
+
+// Limites pré-trade d'un instrument (0 = contrôle désactivé)
+struct RiskLimits {
+    Quantity maxOrderQuantity = 0;  // Quantité maximale d'un ordre
+    double priceCollar = 0;         // Écart relatif max d'un LIMIT au meilleur prix opposé
+    Quantity maxPosition = 0;       // |position nette| max par compte, ordres ouverts compris
+    double maxOpenNotional = 0;     // Notionnel ouvert max par compte (prix x reste des ordres actifs)
+    
+    bool isEnabled() const {
+        return maxOrderQuantity > 0 || priceCollar > 0 || maxPosition > 0 || maxOpenNotional > 0;
+    }
+};
+
+// Exposition d'un compte (propriétaire) sur l'instrument
+struct AccountExposure {
+    int64_t position = 0;       // Achats exécutés - ventes exécutées
+    Quantity openBuy = 0;       // Reste des ordres d'achat actifs
+    Quantity openSell = 0;      // Reste des ordres de vente actifs
+    double openNotional = 0;    // Somme prix x reste des ordres actifs
+};
+
+// Contrôles pré-trade d'un MatchingEngine. Les compteurs par compte sont
+// tenus à jour incrémentalement : la position à chaque exécution, l'exposition
+// ouverte par différence avec ce que chaque ordre avait déjà compté.
+// Le contrôle d'un ordre ne fait donc qu'une recherche de compte.
+class RiskChecker {
+private:
+    RiskLimits limits_;
+    std::pmr::unordered_map<OwnerId, AccountExposure> accounts_;
+    
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+    
+    explicit RiskChecker(const allocator_type& alloc = {}) : accounts_(alloc) {}
+    
+    void setLimits(const RiskLimits& limits) { limits_ = limits; }
+    const RiskLimits& getLimits() const { return limits_; }
+    bool isEnabled() const { return limits_.isEnabled(); }
+    
+    // Contrôle d'un ordre de `quantity` au total. `replaced` : ordre existant
+    // modifié, dont l'exposition ouverte est remplacée par celle du nouvel état.
+    // Les limites par compte ne s'appliquent qu'aux ordres avec propriétaire.
+    RiskRejection check(const OrderBook& book, Side side, OrderType type, Quantity quantity,
+                        Price price, OwnerId owner, const Order* replaced = nullptr) const;
+    
+    // Exécution : positions des deux comptes
+    void onFill(const Order& buyOrder, const Order& sellOrder, Quantity quantity);
+    // Aligne l'exposition ouverte du compte sur le reste actif de l'ordre
+    // (sans effet si rien n'a changé depuis le dernier appel)
+    void reconcile(Order& order);
+    
+    // Restauration de snapshot
+    void restorePosition(OwnerId owner, int64_t position) { accounts_[owner].position = position; }
+    // Remet l'exposition ouverte à zéro avant un recalcul complet
+    void clearOpenExposure();
+    
+    const AccountExposure* findAccount(OwnerId owner) const;
+    
+    template<typename Visitor>
+    void forEachAccount(Visitor&& visit) const {
+        for (const auto& [owner, exposure] : accounts_) visit(owner, exposure);
+    }
+};
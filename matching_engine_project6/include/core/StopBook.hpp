@@ -0,0 +1,99 @@
+// ===== include/core/StopBook.hpp =====
+#pragma once
+#include "core/Order.hpp"
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <limits>
+#include <functional>
+#include <memory_resource>
+
+// Carnet de déclenchement des ordres stop d'un OrderBook, indexé par prix de
+// déclenchement. Un stop d'achat se déclenche quand le dernier prix échangé
+// est >= à son stop, un stop de vente quand il est <= à son stop. Les deux
+// frontières les plus proches sont gardées en cache : le test par trade se
+// réduit à deux comparaisons tant que rien ne se déclenche.
+class StopBook {
+private:
+    using Bucket = std::pmr::vector<OrderPtr>;  // Priorité temps à prix égal
+
+    std::pmr::map<Price, Bucket> buyStops_;                        // Plus petit stop en tête
+    std::pmr::map<Price, Bucket, std::greater<Price>> sellStops_;  // Plus grand stop en tête
+    std::pmr::unordered_map<OrderId, OrderPtr> index_;
+    Price buyTrigger_;   // +infini si aucun stop d'achat
+    Price sellTrigger_;  // -infini si aucun stop de vente
+
+    // Ordres déclenchés pendant le matching courant, dans l'ordre de déclenchement
+    std::pmr::vector<OrderPtr> triggered_;
+    size_t triggeredHead_;
+
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    explicit StopBook(const allocator_type& alloc = {});
+
+    void addOrder(OrderPtr order);
+    bool removeOrder(OrderId orderId);  // false si l'ordre n'y est pas
+    OrderPtr findOrder(OrderId orderId) const;
+    
+    // Retire en un passage les stops qui satisfont pred, ajoutés à `removed`
+    // dans l'ordre de déclenchement
+    template<typename Predicate>
+    void removeIf(Predicate&& pred, std::pmr::vector<OrderPtr>& removed) {
+        sweep(buyStops_, pred, removed);
+        sweep(sellStops_, pred, removed);
+        updateTriggers();
+    }
+
+    // Vrai si le stop de l'ordre est déjà atteint par lastPrice (0 = aucun trade)
+    static bool isTriggeredBy(const Order& order, Price lastPrice);
+
+    // Appelé à chaque prix d'exécution : O(1) si aucune frontière n'est franchie
+    inline void onTrade(Price lastPrice) {
+        if (lastPrice >= buyTrigger_ || lastPrice <= sellTrigger_) collect(lastPrice);
+    }
+
+    // File des ordres déclenchés : vidée par le matcher (cascade), conservée
+    // jusqu'au matching suivant pour la génération des événements
+    void clearTriggered() { triggered_.clear(); triggeredHead_ = 0; }
+    OrderPtr popTriggered() {
+        return triggeredHead_ < triggered_.size() ? triggered_[triggeredHead_++] : nullptr;
+    }
+    const std::pmr::vector<OrderPtr>& getTriggered() const { return triggered_; }
+
+    bool isEmpty() const { return index_.empty(); }
+    size_t getOrderCount() const { return index_.size(); }
+
+    // Parcours dans l'ordre de déclenchement : stops d'achat puis de vente
+    template<typename Visitor>
+    void forEach(Visitor&& visit) const {
+        for (const auto& [price, bucket] : buyStops_) {
+            for (const auto& order : bucket) visit(order);
+        }
+        for (const auto& [price, bucket] : sellStops_) {
+            for (const auto& order : bucket) visit(order);
+        }
+    }
+
+private:
+    template<typename StopMap, typename Predicate>
+    void sweep(StopMap& stops, Predicate& pred, std::pmr::vector<OrderPtr>& removed) {
+        for (auto level = stops.begin(); level != stops.end();) {
+            auto& bucket = level->second;
+            auto kept = bucket.begin();
+            for (auto& order : bucket) {
+                if (pred(*order)) {
+                    index_.erase(order->getOrderId());
+                    removed.push_back(std::move(order));
+                } else {
+                    *kept++ = std::move(order);
+                }
+            }
+            bucket.erase(kept, bucket.end());
+            level = bucket.empty() ? stops.erase(level) : std::next(level);
+        }
+    }
+    
+    void collect(Price lastPrice);
+    void updateTriggers();
+};
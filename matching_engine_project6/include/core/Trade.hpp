@@ -2,18 +2,19 @@
 // ===== include/core/Trade.hpp =====
 #pragma once
 #include "types/OrderTypes.hpp"
-#include <string>
+#include <string_view>
 
 struct Trade {
     Timestamp timestamp;
     OrderId buyOrderId;
     OrderId sellOrderId;
-    std::string instrument;
+    std::string_view instrument;  // Vue sur l'instrument du carnet (trade transitoire)
     Quantity quantity;
     Price price;
+    OrderId aggressorId;          // Ordre entrant (0 pour un fixing d'enchère)
     
     Trade(Timestamp ts, OrderId buyId, OrderId sellId, 
-          const std::string& inst, Quantity qty, Price p)
+          std::string_view inst, Quantity qty, Price p, OrderId aggressor = 0)
         : timestamp(ts), buyOrderId(buyId), sellOrderId(sellId),
-          instrument(inst), quantity(qty), price(p) {}
+          instrument(inst), quantity(qty), price(p), aggressorId(aggressor) {}
 };
\ No newline at end of file
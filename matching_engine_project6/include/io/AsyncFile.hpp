@@ -0,0 +1,111 @@
+// ===== include/io/AsyncFile.hpp =====
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Accès fichier par blocs pour CSVReader et CSVWriter. En mode URING, les
+// lectures sont soumises à un anneau io_uring (appels système directs, sans
+// liburing) plusieurs blocs en avance sur le parseur, et les tampons de
+// sortie pleins sont soumis sans attendre puis recyclés depuis un pool fixe.
+// En mode SYNC, ou si io_uring est indisponible (noyau, seccomp), les mêmes
+// blocs passent par pread/pwrite dans le thread appelant.
+enum class IoBackend : uint8_t {
+    SYNC,
+    URING
+};
+
+struct AsyncIoConfig {
+    IoBackend backend = IoBackend::SYNC;
+    size_t blockBytes = 1 << 20;    // Taille d'une lecture / d'un tampon de sortie
+    size_t depth = 4;               // Lectures en vol / tampons du pool de sortie
+};
+
+const char* ioBackendName(IoBackend backend);
+
+class IoUring;
+
+// Lecture séquentielle d'un fichier par blocs, dans l'ordre du fichier
+class AsyncFileReader {
+private:
+    struct Block {
+        std::vector<char> data;
+        uint64_t offset = 0;
+        size_t length = 0;              // Octets demandés, puis lus
+        bool pending = false;           // Lecture soumise, pas encore terminée
+    };
+    
+    std::string filename_;
+    int fd_;
+    uint64_t size_;
+    std::unique_ptr<IoUring> ring_;
+    std::vector<Block> blocks_;
+    uint64_t nextOffset_;               // Prochaine lecture à soumettre
+    size_t current_;                    // Bloc rendu par le dernier next()
+    bool started_;
+    
+    void submit(Block& block);
+    void complete(uint64_t index, int result);
+    void readSync(Block& block, size_t from);
+
+public:
+    AsyncFileReader(const std::string& filename, const AsyncIoConfig& config = {});
+    ~AsyncFileReader();
+    
+    AsyncFileReader(const AsyncFileReader&) = delete;
+    AsyncFileReader& operator=(const AsyncFileReader&) = delete;
+    
+    // Bloc suivant (vide en fin de fichier), valide jusqu'à l'appel suivant
+    std::string_view next();
+    
+    IoBackend getBackend() const { return ring_ ? IoBackend::URING : IoBackend::SYNC; }
+    uint64_t getSize() const { return size_; }
+};
+
+// Tampon de flux écrivant un fichier par blocs : un std::ostream formate
+// directement dans le bloc courant du pool
+class AsyncFileWriter : public std::streambuf {
+private:
+    struct Block {
+        std::vector<char> data;
+        size_t length = 0;
+        uint64_t offset = 0;
+        bool pending = false;
+    };
+    
+    std::string filename_;
+    int fd_;
+    std::unique_ptr<IoUring> ring_;
+    std::vector<Block> blocks_;
+    size_t current_;
+    uint64_t fileOffset_;
+    bool failed_;
+    
+    // Soumet le bloc courant et passe au bloc libre suivant
+    void submitCurrent();
+    void waitCompletion();
+    void complete(uint64_t index, int result);
+    void writeSync(const char* data, size_t length, uint64_t offset);
+    void drain();
+
+protected:
+    int_type overflow(int_type ch) override;
+    int sync() override;
+
+public:
+    AsyncFileWriter(const std::string& filename, const AsyncIoConfig& config = {});
+    ~AsyncFileWriter() override;
+    
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+    
+    // Écrit tout ce qui est en tampon et attend la fin des écritures ;
+    // lance FileIOException si une écriture a échoué
+    void flush();
+    
+    IoBackend getBackend() const { return ring_ ? IoBackend::URING : IoBackend::SYNC; }
+};
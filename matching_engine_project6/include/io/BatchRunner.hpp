@@ -0,0 +1,47 @@
+// ===== include/io/BatchRunner.hpp =====
+#pragma once
+#include "io/Session.hpp"
+#include <ostream>
+#include <string>
+#include <vector>
+
+struct BatchOptions {
+    std::string outputDir;
+    size_t threads = 0;         // 0 = un worker par cœur
+    SessionOptions session;     // Appliquées à chaque fichier (sans snapshot ni journal)
+};
+
+struct BatchEntry {
+    SessionStats stats;
+    std::string outputFile;
+    std::string error;          // Vide si la session a réussi
+};
+
+struct BatchReport {
+    std::vector<BatchEntry> entries;    // Dans l'ordre des fichiers d'entrée
+    size_t threads = 0;
+    size_t steals = 0;
+    double wallSeconds = 0.0;
+    
+    size_t getTotalOrders() const;
+    size_t getTotalEvents() const;
+    uint64_t getTotalBytes() const;
+    size_t getFailureCount() const;
+};
+
+// Backtest multi-fichiers : une session indépendante (InstrumentManager dédié)
+// par fichier d'entrée, exécutées en parallèle sur un pool à vol de tâches,
+// plus gros fichiers d'abord pour ne pas finir sur une longue session isolée.
+class BatchRunner {
+public:
+    // Développe les motifs glob ("data/2024-*.csv"), triés et sans doublons
+    static std::vector<std::string> expandInputs(const std::vector<std::string>& patterns);
+    
+    // Sortie de chaque fichier : <outputDir>/<nom>_output.csv
+    static std::string outputFileFor(const std::string& inputFile, const std::string& outputDir);
+    
+    static BatchReport run(const std::vector<std::string>& inputFiles, const BatchOptions& options);
+    
+    static void printReport(const BatchReport& report, std::ostream& out);
+    static void writeReportCSV(const BatchReport& report, const std::string& filename);
+};
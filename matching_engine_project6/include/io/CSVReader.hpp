@@ -1,22 +1,32 @@
 // ===== include/io/CSVReader.hpp =====
 #pragma once
+#include "io/AsyncFile.hpp"
 #include <string>
+#include <string_view>
 #include <vector>
-#include <fstream>
 #include <functional>
 
 class CSVReader {
 private:
-    std::ifstream file_;
+    AsyncFileReader file_;
+    std::string_view block_;        // Bloc courant, consommé jusqu'à position_
+    size_t position_;
+    bool eof_;
     char delimiter_;
     size_t lineNumber_;
     
+    // Ligne suivante sans le '\n' ; false en fin de fichier
+    bool nextLine(std::string& line);
+    
 public:
-    explicit CSVReader(const std::string& filename, char delim = ',');
+    explicit CSVReader(const std::string& filename, char delim = ',', const AsyncIoConfig& io = {});
     ~CSVReader();
     
     void readLine(std::function<void(const std::vector<std::string>&)> callback);
+    // Saute les `count` prochaines lignes de données sans les parser
+    void skip(size_t count);
     bool hasNext() const;
+    IoBackend getBackend() const { return file_.getBackend(); }
     
 private:
     std::vector<std::string> parseLine(const std::string& line);
@@ -2,17 +2,28 @@
 // ===== include/io/CSVWriter.hpp =====
 #pragma once
 #include "core/OrderEvent.hpp"
-#include <fstream>
+#include "core/Trade.hpp"
+#include "io/AsyncFile.hpp"
+#include <ostream>
 #include <string>
 
 class CSVWriter {
 private:
-    std::ofstream file_;
+    AsyncFileWriter buffer_;        // Blocs de sortie, soumis quand ils sont pleins
+    std::ostream file_;
     
 public:
-    explicit CSVWriter(const std::string& filename);
+    explicit CSVWriter(const std::string& filename, const AsyncIoConfig& io = {});
     ~CSVWriter();
     
     void writeHeader();
     void writeEvent(const OrderEvent& event);
+    
+    // Flux de trades (EventMode::TRADES) : une ligne par exécution
+    void writeTradeHeader();
+    void writeTrade(const Trade& trade);
+    
+    // Attend la fin des écritures ; FileIOException en cas d'échec
+    void flush();
+    IoBackend getBackend() const { return buffer_.getBackend(); }
 };
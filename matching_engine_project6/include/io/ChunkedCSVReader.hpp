@@ -0,0 +1,58 @@
+// ===== include/io/ChunkedCSVReader.hpp =====
+#pragma once
+#include "io/OrderParser.hpp"
+#include "utils/Metrics.hpp"
+#include "utils/ThreadPool.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+// Lecture parallèle d'un gros fichier d'ordres : le fichier projeté en mémoire
+// est découpé en tranches d'octets alignées sur les fins de ligne, chaque
+// tranche est parsée en OrderRecord sur le pool de threads, puis les tranches
+// sont rendues au callback dans l'ordre du fichier. Seul le parsing est
+// parallèle : le callback (matching) reste appelé séquentiellement.
+class ChunkedCSVReader {
+private:
+    struct Chunk {
+        size_t begin = 0;
+        size_t end = 0;
+        size_t lineCount = 0;               // Lignes physiques, vides comprises
+        std::vector<OrderRecord> records;
+        bool ready = false;
+    };
+    
+    std::string filename_;
+    const char* data_;
+    size_t size_;
+    size_t threads_;
+    char delimiter_;
+    std::vector<Chunk> chunks_;
+    size_t skip_;
+    MetricCounter* inFlightGauge_;
+    ThreadPlacement placement_;
+    
+    void splitChunks(size_t chunkBytes);
+    void parseChunk(Chunk& chunk) const;
+    
+public:
+    static constexpr size_t DEFAULT_CHUNK_BYTES = 4 << 20;
+    
+    ChunkedCSVReader(const std::string& filename, size_t threads,
+                     size_t chunkBytes = DEFAULT_CHUNK_BYTES, char delim = ',');
+    ~ChunkedCSVReader();
+    
+    ChunkedCSVReader(const ChunkedCSVReader&) = delete;
+    ChunkedCSVReader& operator=(const ChunkedCSVReader&) = delete;
+    
+    // Appelle `callback` pour chaque ligne non vide, dans l'ordre du fichier
+    void readRecords(std::function<void(const OrderRecord&)> callback);
+    // Saute les `count` premières lignes de données (parsées mais non rendues)
+    void skip(size_t count) { skip_ += count; }
+    // Jauge optionnelle des tranches soumises au pool et pas encore consommées
+    void setInFlightGauge(MetricCounter* gauge) { inFlightGauge_ = gauge; }
+    // Placement des threads de parsing (nœud du thread de matching en mode NUMA)
+    void setPlacement(const ThreadPlacement& placement) { placement_ = placement; }
+    
+    size_t getChunkCount() const { return chunks_.size(); }
+};
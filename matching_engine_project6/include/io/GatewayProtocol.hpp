@@ -0,0 +1,130 @@
+// ===== include/io/GatewayProtocol.hpp =====
+#pragma once
+#include "core/OrderEvent.hpp"
+#include "types/Enums.hpp"
+#include "types/OrderOptions.hpp"
+#include "types/OrderTypes.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+// Protocole binaire de la passerelle d'ordres : messages de taille fixe,
+// précédés d'un en-tête (longueur totale, type), dans l'ordre des octets de
+// la machine (socket Unix ou boucle locale uniquement).
+//   client -> passerelle : ORDER (une action), SUBSCRIBE (drop copy)
+//   passerelle -> client : EVENT (un OrderEvent), envoyé à la connexion qui a
+//   soumis l'action et à tous les abonnés drop copy
+
+constexpr uint8_t kGatewayProtocolVersion = 1;
+constexpr size_t kGatewaySymbolSize = 16;
+
+enum class GatewayMessageType : uint8_t {
+    ORDER = 1,
+    SUBSCRIBE = 2,
+    EVENT = 3
+};
+
+struct GatewayHeader {
+    uint16_t length;           // Taille du message, en-tête compris
+    uint8_t type;              // GatewayMessageType
+    uint8_t version;
+};
+
+struct GatewayOrder {
+    GatewayHeader header;
+    uint8_t side;
+    uint8_t type;
+    uint8_t action;
+    uint8_t symbolLength;
+    Timestamp timestamp;       // 0 : horodaté par la passerelle à la réception
+    OrderId orderId;
+    Quantity quantity;
+    Price price;
+    OwnerId owner;
+    Quantity displayQuantity;
+    Price stopPrice;
+    uint8_t timeInForce;
+    uint8_t selfTradePrevention;
+    uint8_t padding[6];
+    char symbol[kGatewaySymbolSize];
+};
+
+struct GatewaySubscribe {
+    GatewayHeader header;
+    uint32_t reserved;
+};
+
+struct GatewayEvent {
+    GatewayHeader header;
+    uint8_t side;
+    uint8_t type;
+    uint8_t action;
+    uint8_t status;
+    Timestamp timestamp;
+    OrderId orderId;
+    Quantity displayQuantity;
+    Price price;
+    Quantity executedQuantity;
+    Price executionPrice;
+    OrderId counterpartyId;
+    uint8_t symbolLength;
+    uint8_t padding[7];
+    char symbol[kGatewaySymbolSize];
+};
+
+static_assert(std::is_trivially_copyable_v<GatewayOrder>);
+static_assert(std::is_trivially_copyable_v<GatewayEvent>);
+static_assert(sizeof(GatewayOrder) % 8 == 0 && sizeof(GatewayEvent) % 8 == 0,
+              "Gateway messages must stay 8-byte aligned");
+
+template<typename Message>
+inline GatewayHeader gatewayHeader(GatewayMessageType type) {
+    return {static_cast<uint16_t>(sizeof(Message)), static_cast<uint8_t>(type), kGatewayProtocolVersion};
+}
+
+// Renvoie false si le symbole ne tient pas dans le message
+inline bool encodeGatewayOrder(GatewayOrder& message, Timestamp timestamp, OrderId id,
+                               std::string_view instrument, Side side, OrderType type,
+                               Quantity quantity, Price price, Action action,
+                               const OrderOptions& options = {}) {
+    if (instrument.empty() || instrument.size() > kGatewaySymbolSize) return false;
+    message = {};
+    message.header = gatewayHeader<GatewayOrder>(GatewayMessageType::ORDER);
+    message.side = static_cast<uint8_t>(side);
+    message.type = static_cast<uint8_t>(type);
+    message.action = static_cast<uint8_t>(action);
+    message.symbolLength = static_cast<uint8_t>(instrument.size());
+    message.timestamp = timestamp;
+    message.orderId = id;
+    message.quantity = quantity;
+    message.price = price;
+    message.owner = options.owner;
+    message.displayQuantity = options.displayQuantity;
+    message.stopPrice = options.stopPrice;
+    message.timeInForce = static_cast<uint8_t>(options.timeInForce);
+    message.selfTradePrevention = static_cast<uint8_t>(options.selfTradePrevention);
+    std::memcpy(message.symbol, instrument.data(), instrument.size());
+    return true;
+}
+
+inline void encodeGatewayEvent(GatewayEvent& message, const OrderEvent& event) {
+    message = {};
+    message.header = gatewayHeader<GatewayEvent>(GatewayMessageType::EVENT);
+    message.side = static_cast<uint8_t>(event.side);
+    message.type = static_cast<uint8_t>(event.type);
+    message.action = static_cast<uint8_t>(event.action);
+    message.status = static_cast<uint8_t>(event.status);
+    message.timestamp = event.actionTimestamp;
+    message.orderId = event.orderId;
+    message.displayQuantity = event.displayQuantity;
+    message.price = event.price;
+    message.executedQuantity = event.executedQuantity;
+    message.executionPrice = event.executionPrice;
+    message.counterpartyId = event.counterpartyId;
+    size_t length = std::min(event.instrument.size(), kGatewaySymbolSize);
+    message.symbolLength = static_cast<uint8_t>(length);
+    std::memcpy(message.symbol, event.instrument.data(), length);
+}
@@ -0,0 +1,49 @@
+// ===== include/io/JournalFormat.hpp =====
+#pragma once
+#include "types/OrderTypes.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+// Journal append-only : suite d'enregistrements de taille fixe. Chaque
+// enregistrement porte une somme de contrôle ; à la reprise, le journal est
+// relu jusqu'au premier enregistrement tronqué ou corrompu (écriture
+// interrompue par un crash), et le fichier est tronqué à cet endroit.
+
+constexpr size_t kJournalSymbolSize = 32;
+
+struct JournalRecord {
+    uint64_t sequence;         // Numéro d'enregistrement dans le journal
+    uint64_t inputSequence;    // Position dans le flux d'entrée (lignes appliquées)
+    Timestamp timestamp;
+    OrderId orderId;
+    Quantity quantity;
+    Price price;
+    uint8_t side;
+    uint8_t type;
+    uint8_t action;
+    uint8_t symbolLength;
+    uint32_t checksum;         // FNV-1a sur l'enregistrement, checksum à 0
+    char symbol[kJournalSymbolSize];
+    OwnerId owner;
+    uint8_t selfTradePrevention;
+    uint8_t timeInForce;
+    uint8_t allSides;          // MASS_CANCEL : 1 = les deux côtés (side ignoré)
+    uint8_t padding[5];
+    Quantity displayQuantity;  // Iceberg (0 = tout est visible)
+    Price stopPrice;           // Stop (0 = aucun)
+};
+
+static_assert(std::is_trivially_copyable_v<JournalRecord>);
+static_assert(sizeof(JournalRecord) % 8 == 0, "Journal records must stay 8-byte aligned");
+
+inline uint32_t journalChecksum(const JournalRecord& record) {
+    JournalRecord copy = record;
+    copy.checksum = 0;
+    const auto* bytes = reinterpret_cast<const unsigned char*>(&copy);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < sizeof(copy); ++i) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
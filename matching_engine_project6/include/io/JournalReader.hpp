@@ -0,0 +1,21 @@
+// ===== include/io/JournalReader.hpp =====
+#pragma once
+#include "core/InstrumentManager.hpp"
+#include <string>
+
+struct JournalRecovery {
+    uint64_t records = 0;             // Enregistrements valides dans le journal
+    uint64_t applied = 0;             // Rejoués dans le manager
+    uint64_t errors = 0;              // Rejoués mais rejetés par le moteur (comme à l'origine)
+    uint64_t lastInputSequence = 0;   // Position d'entrée du dernier enregistrement valide
+    bool tornTail = false;            // Fin tronquée/corrompue supprimée
+};
+
+class JournalReader {
+public:
+    // Rejoue dans le manager les enregistrements postérieurs à
+    // afterInputSequence (position d'un snapshot), puis tronque le fichier
+    // après le dernier enregistrement valide pour pouvoir le compléter.
+    static JournalRecovery recover(const std::string& filename, InstrumentManager& manager,
+                                   uint64_t afterInputSequence = 0);
+};
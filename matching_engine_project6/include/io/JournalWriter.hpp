@@ -0,0 +1,74 @@
+// ===== include/io/JournalWriter.hpp =====
+#pragma once
+#include "io/JournalFormat.hpp"
+#include "types/Enums.hpp"
+#include "types/OrderOptions.hpp"
+#include "utils/SpscRing.hpp"
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <thread>
+
+struct JournalConfig {
+    size_t groupCommitRecords = 256;     // fsync au plus tard tous les N enregistrements...
+    uint64_t groupCommitMicros = 1000;   // ... ou toutes les T microsecondes
+    size_t ringCapacity = 1 << 16;       // Enregistrements en attente côté thread de matching
+};
+
+// Journal append-only des actions d'ordres. Le thread de matching ne fait
+// qu'une copie dans une file SPSC ; un thread de fond écrit les
+// enregistrements par lots et fait le fdatasync (group commit).
+class JournalWriter {
+private:
+    std::string filename_;
+    JournalConfig config_;
+    int fd_;
+    SpscRing<JournalRecord> ring_;
+    
+    // Côté producteur (thread de matching)
+    uint64_t nextSequence_;
+    uint64_t inputSequence_;
+    uint64_t stalls_;
+    
+    // Côté thread de fond
+    std::atomic<uint64_t> durableSequence_;
+    std::atomic<uint64_t> commits_;
+    std::atomic<bool> flushRequested_;
+    std::atomic<bool> failed_;
+    std::atomic<bool> running_;
+    std::thread thread_;
+    
+public:
+    // startSequence > 0 : reprise après recover(), le fichier est complété ;
+    // sinon un journal existant est tronqué
+    explicit JournalWriter(const std::string& filename, const JournalConfig& config = {},
+                           uint64_t startSequence = 0);
+    ~JournalWriter();
+    
+    JournalWriter(const JournalWriter&) = delete;
+    JournalWriter& operator=(const JournalWriter&) = delete;
+    
+    // Position courante dans le flux d'entrée, recopiée dans chaque enregistrement
+    void setInputSequence(uint64_t inputSequence) { inputSequence_ = inputSequence; }
+    
+    void append(Timestamp timestamp, OrderId id, std::string_view instrument,
+                Side side, OrderType type, Quantity quantity, Price price, Action action,
+                const OrderOptions& options = {});
+    void appendMassCancel(Timestamp timestamp, OrderId id, std::string_view instrument,
+                          const MassCancelFilter& filter);
+    
+    // Bloque jusqu'à ce que tous les enregistrements ajoutés soient durables
+    void flush();
+    
+    uint64_t getAppendedCount() const { return nextSequence_; }
+    uint64_t getDurableCount() const { return durableSequence_.load(std::memory_order_acquire); }
+    uint64_t getCommitCount() const { return commits_.load(std::memory_order_relaxed); }
+    uint64_t getStallCount() const { return stalls_; }
+    size_t getPendingCount() const { return ring_.size(); }
+    
+private:
+    JournalRecord makeRecord(Timestamp timestamp, OrderId id, std::string_view instrument, Action action);
+    void push(JournalRecord& record);
+    void run();
+    void commit(const JournalRecord* records, size_t count);
+};
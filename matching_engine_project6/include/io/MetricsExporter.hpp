@@ -0,0 +1,52 @@
+// ===== include/io/MetricsExporter.hpp =====
+#pragma once
+#include "utils/Metrics.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+class InstrumentManager;
+
+// Étapes du pipeline d'une session, écrites par le thread de matching
+struct alignas(64) PipelineMetrics {
+    LatencyHistogram processLatency;      // Traitement d'une ligne par le moteur
+    MetricCounter inputLines;
+    alignas(64) MetricCounter parseChunksInFlight;  // Tranches soumises au parsing et pas encore consommées
+    MetricCounter journalPending;         // Enregistrements en attente dans la file du journal
+    MetricCounter journalStalls;          // Attentes sur file du journal pleine
+};
+
+// Export des métriques au format texte Prometheus par un thread de fond :
+// réécriture atomique d'un fichier toutes les `intervalMillis` ms, ou
+// réponse à chaque connexion sur une socket Unix si la cible est
+// "unix:<chemin>". Un dernier export est fait à l'arrêt.
+class MetricsExporter {
+private:
+    const InstrumentManager& manager_;
+    const PipelineMetrics& pipeline_;
+    std::string target_;
+    uint64_t intervalMillis_;
+    int listenFd_;
+    
+    std::mutex mutex_;
+    std::condition_variable stopRequested_;
+    bool stopping_;
+    std::thread thread_;
+    
+    void run();
+    void writeFile() const;
+
+public:
+    MetricsExporter(const std::string& target, uint64_t intervalMillis,
+                    const InstrumentManager& manager, const PipelineMetrics& pipeline);
+    ~MetricsExporter();
+    
+    MetricsExporter(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+    
+    // Texte d'exposition Prometheus de toutes les métriques
+    static std::string render(const InstrumentManager& manager, const PipelineMetrics& pipeline);
+};
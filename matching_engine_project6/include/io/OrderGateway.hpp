@@ -0,0 +1,81 @@
+// ===== include/io/OrderGateway.hpp =====
+#pragma once
+#include "io/GatewayProtocol.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class InstrumentManager;
+class MatchingEngine;
+
+struct GatewayConfig {
+    std::string endpoint;                 // "unix:<chemin>" ou "tcp:<port>" (127.0.0.1, 0 = port libre)
+    size_t recvBytes = 1 << 16;           // Lecture par appel à recv
+    size_t maxPendingBytes = 64 << 20;    // Au-delà, un client trop lent est déconnecté
+};
+
+struct GatewayStats {
+    uint64_t connections = 0;
+    uint64_t messages = 0;                // Actions reçues
+    uint64_t events = 0;                  // Événements produits par le moteur
+    uint64_t protocolErrors = 0;          // Connexions fermées sur un message invalide
+    uint64_t slowConsumers = 0;           // Connexions fermées sur file d'envoi pleine
+};
+
+// Passerelle d'ordres en mode serveur : une boucle epoll sur un seul thread,
+// qui est aussi le thread de matching. Chaque réveil lit tout ce qui est
+// disponible sur la connexion (recv par lots), applique les actions
+// complètes à l'InstrumentManager et renvoie les OrderEvent produits à la
+// connexion qui a soumis l'action et aux abonnés drop copy ; les envois sont
+// regroupés en fin de lot. Les événements transmis sont libérés du moteur.
+class OrderGateway {
+private:
+    struct Connection {
+        int fd = -1;
+        std::vector<char> input;          // Message partiel en attente de la suite
+        std::vector<char> output;
+        size_t outputOffset = 0;          // Octets déjà envoyés
+        bool subscriber = false;
+        bool waitingWritable = false;     // EPOLLOUT armé
+    };
+    
+    InstrumentManager& manager_;
+    GatewayConfig config_;
+    int listenFd_;
+    int epollFd_;
+    int wakeFd_;                          // eventfd de stop()
+    std::string unixPath_;
+    uint16_t port_;
+    std::unordered_map<int, Connection> connections_;
+    std::vector<int> subscribers_;
+    std::vector<int> dirty_;              // Connexions à vider en fin de lot
+    std::vector<char> readBuffer_;
+    GatewayStats stats_;
+    
+    void accept();
+    // false si la connexion a été fermée
+    bool readConnection(Connection& connection);
+    bool handleOrder(Connection& connection, const GatewayOrder& message);
+    void queue(Connection& connection, const void* data, size_t size);
+    void flush(Connection& connection);
+    void flushDirty();
+    void close(int fd);
+
+public:
+    OrderGateway(InstrumentManager& manager, const GatewayConfig& config);
+    ~OrderGateway();
+    
+    OrderGateway(const OrderGateway&) = delete;
+    OrderGateway& operator=(const OrderGateway&) = delete;
+    
+    // Boucle jusqu'à stop()
+    void run();
+    // Appelable depuis un autre thread ou un gestionnaire de signal
+    void stop();
+    
+    // Port effectivement écouté (tcp:0)
+    uint16_t getPort() const { return port_; }
+    const GatewayStats& getStats() const { return stats_; }
+};
@@ -0,0 +1,52 @@
+// ===== include/io/OrderParser.hpp =====
+#pragma once
+#include "types/OrderTypes.hpp"
+#include "types/Enums.hpp"
+#include "types/OrderOptions.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Ligne d'entrée convertie en champs typés, prête pour le matching
+struct OrderRecord {
+    enum class Status : uint8_t {
+        VALID,
+        INSUFFICIENT_FIELDS,
+        PARSE_ERROR
+    };
+    
+    Timestamp timestamp = 0;
+    OrderId orderId = 0;
+    std::string instrument;
+    Side side = Side::BUY;
+    OrderType type = OrderType::LIMIT;
+    Quantity quantity = 0;
+    Price price = 0.0;
+    Action action = Action::NEW;
+    OrderOptions options;       // Colonnes facultatives owner_id, stp, tif,
+                                // display_quantity, stop_price
+    MassCancelFilter massCancel;  // Périmètre d'une ligne MASS_CANCEL
+    
+    Status status = Status::VALID;
+    std::string error;          // Message de l'exception de parsing
+    size_t lineNumber = 0;      // Numéro de ligne dans le fichier (0 si inconnu)
+    
+    bool isValid() const { return status == Status::VALID; }
+};
+
+// Fonctions de parsing des champs du CSV d'entrée (lèvent std::invalid_argument)
+Side parseSide(const std::string& str);
+OrderType parseOrderType(const std::string& str);
+Action parseAction(const std::string& str);
+SelfTradePrevention parseSelfTradePrevention(const std::string& str);
+TimeInForce parseTimeInForce(const std::string& str);
+AllocationPolicy parseAllocationPolicy(const std::string& str);
+EventMode parseEventMode(const std::string& str);
+// Gestion spéciale des ordres MARKET : prix toujours 0
+Price parsePrice(const std::string& str, OrderType type);
+
+// Découpe une ligne comme CSVReader (champs trimés, délimiteur final ignoré)
+void splitFields(std::string_view line, char delimiter, std::vector<std::string>& fields);
+
+// Convertit les champs d'une ligne ; les erreurs sont reportées dans `status`
+void parseOrderRecord(const std::vector<std::string>& fields, OrderRecord& record);
@@ -0,0 +1,82 @@
+// ===== include/io/Session.hpp =====
+#pragma once
+#include "core/CapacityConfig.hpp"
+#include "core/OrderBook.hpp"
+#include "core/RiskChecker.hpp"
+#include "io/AsyncFile.hpp"
+#include "io/JournalWriter.hpp"
+#include "types/OrderTypes.hpp"
+#include "types/Enums.hpp"
+#include <string>
+#include <utility>
+#include <vector>
+
+struct SessionOptions {
+    CapacityConfig capacity;        // Mode pré-allocation (désactivé par défaut)
+    std::string snapshotIn;
+    std::string snapshotOut;
+    size_t snapshotEvery = 0;
+    std::string journalFile;
+    JournalConfig journalConfig;
+    bool recover = false;
+    size_t parseThreads = 0;        // > 0 : parsing parallèle par tranches (ChunkedCSVReader)
+    AsyncIoConfig io;               // Lecture (hors parsing parallèle) et écriture des CSV
+    
+    // Placement NUMA : état de la session alloué sur le nœud du thread
+    // appelant, threads de parsing et d'enchère sur ce nœud, thread de
+    // matching fixé sur son cœur pendant le traitement
+    bool numa = false;
+    
+    // Enchères pilotées par l'horodatage des ordres (0 = désactivée). Leur
+    // déroulement n'est ni journalisé ni inclus dans les snapshots : une
+    // reprise (recover, snapshotIn) est refusée avec une enchère.
+    Timestamp openingAuctionEnd = 0;    // Fixing au premier ordre >= T (ou en fin d'entrée)
+    Timestamp closingAuctionStart = 0;  // Enchère à partir du premier ordre >= T, fixing en fin d'entrée
+    size_t auctionThreads = 0;          // > 1 : fixing des instruments en parallèle
+    
+    // Politiques d'allocation intra-niveau par instrument (FIFO sinon)
+    std::vector<std::pair<std::string, AllocationPolicy>> allocationPolicies;
+    
+    // Bandes de prix par instrument (configuration, comme les politiques :
+    // ni journalisées ni incluses dans les snapshots)
+    std::vector<std::pair<std::string, PriceBand>> priceBands;
+    
+    // Événements d'exécution ; en TRADES, le fichier de sortie ne contient
+    // que le flux de trades
+    EventMode eventMode = EventMode::FULL;
+    
+    // Contrôles pré-trade de tous les instruments, appliqués avant la reprise
+    // (snapshot, journal) pour que le rejeu rejette les mêmes ordres
+    RiskLimits riskLimits;
+    
+    // Export des métriques (fichier ou "unix:<chemin>", vide = désactivé)
+    std::string metricsTarget;
+    uint64_t metricsIntervalMillis = 1000;
+};
+
+struct SessionStats {
+    std::string inputFile;
+    uint64_t inputBytes = 0;
+    size_t orderCount = 0;
+    size_t errorCount = 0;          // Lignes illisibles et erreurs fatales
+    size_t rejectCount = 0;         // Actions rejetées par le moteur (événements REJECTED)
+    size_t eventCount = 0;
+    double seconds = 0.0;
+    int numaNode = -1;              // Nœud de la session (-1 sans placement)
+    
+    // Arène pré-allouée (si capacity activée)
+    bool hasArena = false;
+    const char* arenaBacking = "";
+    size_t arenaUsed = 0;
+    size_t arenaCapacity = 0;
+    size_t arenaOverflow = 0;
+};
+
+// Une session de matching : un fichier d'entrée CSV traité par un
+// InstrumentManager dédié, tous les événements écrits dans le fichier de sortie.
+// Les sessions sont indépendantes et peuvent tourner en parallèle.
+class Session {
+public:
+    static SessionStats run(const std::string& inputFile, const std::string& outputFile,
+                            const SessionOptions& options = {});
+};
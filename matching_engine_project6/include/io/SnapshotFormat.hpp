@@ -0,0 +1,78 @@
+// ===== include/io/SnapshotFormat.hpp =====
+#pragma once
+#include "types/OrderTypes.hpp"
+#include <cstdint>
+#include <type_traits>
+
+// Format binaire du snapshot (endianness native, enregistrements de taille
+// fixe alignés sur 8 octets : le fichier est lisible directement via mmap).
+//
+//   SnapshotHeader
+//   SnapshotInstrument[instrumentCount]
+//   SnapshotOrder[orderCount]   groupés par instrument : bids du meilleur au
+//                               pire prix puis asks, priorité temps dans chaque niveau,
+//                               puis les stops non déclenchés (ordre de déclenchement),
+//                               puis les ordres terminés de l'historique (statut
+//                               EXECUTED/CANCELED, requis pour rejouer les CANCEL tardifs)
+//   SnapshotPosition[positionCount] groupées par instrument : positions exécutées
+//                               non nulles des comptes (contrôles pré-trade)
+
+constexpr char kSnapshotMagic[8] = {'M', 'E', 'S', 'N', 'A', 'P', '0', '1'};
+constexpr uint32_t kSnapshotVersion = 7;
+constexpr size_t kSnapshotSymbolSize = 32;
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t instrumentCount;
+    uint64_t sequence;         // Nombre de lignes d'entrée déjà appliquées
+    uint64_t orderCount;
+    uint64_t positionCount;
+};
+
+struct SnapshotInstrument {
+    char symbol[kSnapshotSymbolSize];  // Terminé par '\0'
+    uint64_t firstOrder;               // Index dans le tableau d'ordres
+    uint64_t orderCount;               // Ordres au repos + historique
+    uint64_t restingCount;             // Dont ordres au repos (en tête de plage)
+    Price lastTradePrice;              // Référence des stops (0 = aucun trade)
+    uint64_t firstPosition;            // Index dans le tableau de positions
+    uint64_t positionCount;
+    Timestamp haltEnd;                 // Fin de la suspension de volatilité (0 = aucune)
+    uint8_t phase;                     // TradingPhase
+    uint8_t padding[7];
+};
+
+struct SnapshotOrder {
+    Timestamp timestamp;
+    OrderId orderId;
+    Quantity quantity;
+    Quantity remainingQuantity;
+    Quantity executedQuantity;
+    Price price;
+    Price executionPrice;
+    OrderId counterpartyId;
+    OwnerId owner;
+    uint8_t side;
+    uint8_t type;
+    uint8_t status;
+    uint8_t selfTradePrevention;
+    uint8_t timeInForce;
+    uint8_t padding[3];
+    Quantity displayQuantity;  // Iceberg (0 = tout est visible)
+    Quantity visibleQuantity;  // Tranche iceberg en cours
+    Price stopPrice;           // Stop non déclenché (0 = aucun)
+};
+
+struct SnapshotPosition {
+    OwnerId owner;
+    int64_t position;          // Achats exécutés - ventes exécutées
+};
+
+static_assert(std::is_trivially_copyable_v<SnapshotHeader>);
+static_assert(std::is_trivially_copyable_v<SnapshotInstrument>);
+static_assert(std::is_trivially_copyable_v<SnapshotOrder>);
+static_assert(std::is_trivially_copyable_v<SnapshotPosition>);
+static_assert(sizeof(SnapshotHeader) % 8 == 0 && sizeof(SnapshotInstrument) % 8 == 0 &&
+              sizeof(SnapshotOrder) % 8 == 0 && sizeof(SnapshotPosition) % 8 == 0,
+              "Snapshot records must stay 8-byte aligned");
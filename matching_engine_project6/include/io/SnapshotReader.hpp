@@ -0,0 +1,28 @@
+// ===== include/io/SnapshotReader.hpp =====
+#pragma once
+#include "io/SnapshotFormat.hpp"
+#include "core/InstrumentManager.hpp"
+#include <string>
+
+// Snapshot projeté en mémoire (mmap) : les enregistrements sont lus en place
+class SnapshotReader {
+private:
+    std::string filename_;
+    const char* data_;
+    size_t size_;
+    
+public:
+    explicit SnapshotReader(const std::string& filename);
+    ~SnapshotReader();
+    
+    SnapshotReader(const SnapshotReader&) = delete;
+    SnapshotReader& operator=(const SnapshotReader&) = delete;
+    
+    const SnapshotHeader& header() const;
+    const SnapshotInstrument* instruments() const;
+    const SnapshotOrder* orders() const;
+    const SnapshotPosition* positions() const;
+    
+    // Reconstruit les carnets dans le manager, renvoie la position d'entrée
+    uint64_t restore(InstrumentManager& manager) const;
+};
@@ -0,0 +1,13 @@
+// ===== include/io/SnapshotWriter.hpp =====
+#pragma once
+#include "core/InstrumentManager.hpp"
+#include <string>
+
+class SnapshotWriter {
+public:
+    // Écrit l'état de tous les carnets (ordres au repos en priorité prix-temps)
+    // et la position dans le flux d'entrée. Écriture dans un fichier temporaire
+    // puis rename : un snapshot existant n'est jamais laissé à moitié écrit.
+    static void write(const std::string& filename, const InstrumentManager& manager,
+                      uint64_t sequence);
+};
@@ -1,6 +1,7 @@
 
 // ===== include/types/Enums.hpp =====
 #pragma once
+#include <cstddef>
 #include <cstdint>
 
 enum class Side : uint8_t {
@@ -16,7 +17,8 @@ enum class OrderType : uint8_t {
 enum class Action : uint8_t {
     NEW,
     MODIFY,
-    CANCEL
+    CANCEL,
+    MASS_CANCEL   // Annulation en bloc selon un MassCancelFilter
 };
 
 enum class OrderStatus : uint8_t {
@@ -25,4 +27,66 @@ enum class OrderStatus : uint8_t {
     PARTIALLY_EXECUTED,
     CANCELED,
     REJECTED
-};
\ No newline at end of file
+};
+
+// Durée de validité d'un ordre LIMIT (les ordres MARKET sont toujours IOC)
+enum class TimeInForce : uint8_t {
+    GTC,   // Reste au carnet jusqu'à exécution ou annulation
+    IOC,   // Exécute ce qui est possible immédiatement, annule le reliquat
+    FOK,   // Exécution totale immédiate ou annulation, sans toucher au carnet
+    DAY    // Expire à la fin de la journée (changement de jour UTC ou fin de session)
+};
+
+// Allocation entre les ordres d'un même niveau, par instrument
+enum class AllocationPolicy : uint8_t {
+    FIFO,          // Priorité temps stricte
+    PRO_RATA,      // Au prorata des quantités
+    TOP_PRO_RATA   // Ordre en tête de file prioritaire, puis prorata
+};
+
+// Événements d'exécution produits par un moteur
+enum class EventMode : uint8_t {
+    FULL,        // Un événement par côté et par fill
+    AGGREGATED,  // Un événement par fill passif, un résumé de l'agresseur par niveau de prix
+    TRADES       // Aucun événement d'exécution : un enregistrement par trade
+};
+
+// Phase de négociation d'un instrument
+enum class TradingPhase : uint8_t {
+    CONTINUOUS,  // Matching à l'arrivée de chaque ordre
+    AUCTION      // Enchère : les ordres s'accumulent, exécution en bloc au fixing
+};
+
+// Motif de rejet d'un ordre par les contrôles pré-trade
+enum class RiskRejection : uint8_t {
+    NONE,
+    ORDER_SIZE,      // Quantité au-delà de la taille maximale (ou sans reste pour un MODIFY)
+    PRICE_COLLAR,    // Prix hors du collier autour du meilleur prix opposé
+    POSITION,        // Position nette du compte (ordres ouverts compris) au-delà de la limite
+    OPEN_NOTIONAL    // Notionnel ouvert du compte au-delà de la limite
+};
+
+// Motif de rejet d'une action par le moteur (événement REJECTED, sans exception)
+enum class OrderRejection : uint8_t {
+    NONE,
+    INVALID_ORDER_ID,   // Identifiant nul
+    EMPTY_INSTRUMENT,
+    INVALID_QUANTITY,   // Quantité nulle (ou, pour un MODIFY, pas au-delà de l'exécuté)
+    INVALID_PRICE,      // Prix LIMIT non positif
+    UNKNOWN_ORDER,      // MODIFY d'un ordre absent du carnet, CANCEL d'un ordre inconnu
+    NOT_MODIFIABLE,     // MODIFY d'un ordre MARKET
+    AUCTION_PHASE,      // MARKET, IOC ou FOK pendant une enchère
+    RISK_LIMIT,         // Contrôles pré-trade (motif détaillé par RiskChecker::check)
+    DUPLICATE_ORDER_ID, // NEW avec l'identifiant d'un ordre encore actif
+    ORDER_CLOSED        // CANCEL d'un ordre déjà exécuté ou annulé
+};
+constexpr size_t kOrderRejectionCount = 11;
+
+// Prévention d'auto-exécution, appliquée selon le mode de l'ordre entrant
+enum class SelfTradePrevention : uint8_t {
+    NONE,
+    CANCEL_NEWEST,         // Annule l'ordre entrant
+    CANCEL_OLDEST,         // Annule l'ordre au repos et continue le matching
+    CANCEL_BOTH,           // Annule les deux
+    DECREMENT_AND_CANCEL   // Réduit les deux de la plus petite quantité, annule celui qui tombe à 0
+};
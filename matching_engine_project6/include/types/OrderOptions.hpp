@@ -0,0 +1,22 @@
+// ===== include/types/OrderOptions.hpp =====
+#pragma once
+#include "types/OrderTypes.hpp"
+#include "types/Enums.hpp"
+
+// Attributs optionnels d'un ordre (colonnes facultatives du CSV d'entrée)
+struct OrderOptions {
+    OwnerId owner = 0;  // Sans propriétaire, aucune prévention d'auto-exécution
+    SelfTradePrevention selfTradePrevention = SelfTradePrevention::NONE;
+    TimeInForce timeInForce = TimeInForce::GTC;
+    Quantity displayQuantity = 0;  // Iceberg : tranche visible (0 = tout est visible)
+    Price stopPrice = 0;           // Stop / stop-limit : prix de déclenchement (0 = aucun)
+};
+
+// Périmètre d'une annulation de masse (action MASS_CANCEL) : un critère
+// laissé à sa valeur par défaut ne filtre rien
+struct MassCancelFilter {
+    bool allSides = true;
+    Side side = Side::BUY;  // Côté visé si !allSides
+    OwnerId owner = 0;      // 0 = tous les propriétaires
+    Price priceBound = 0;   // 0 = tous les prix, sinon achats >= borne et ventes <= borne
+};
@@ -7,4 +7,5 @@
 using OrderId = uint64_t;
 using Price = double;
 using Quantity = uint64_t;
-using Timestamp = uint64_t;
\ No newline at end of file
+using Timestamp = uint64_t;
+using OwnerId = uint64_t;  // Compte propriétaire (0 = aucun)
\ No newline at end of file
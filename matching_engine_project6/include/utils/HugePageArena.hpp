@@ -0,0 +1,53 @@
+// ===== include/utils/HugePageArena.hpp =====
+#pragma once
+#include <cstddef>
+#include <memory_resource>
+
+// memory_resource monotone adossée à une région mmap pré-touchée.
+// Tente MAP_HUGETLB, puis des pages normales avec madvise(MADV_HUGEPAGE)
+// (transparent huge pages), puis des pages normales. Une fois la région
+// épuisée, les allocations sont déléguées à l'upstream.
+// À placer sous un std::pmr::unsynchronized_pool_resource pour réutiliser
+// les blocs libérés en régime établi. Avec un nœud NUMA, les pages sont
+// liées à ce nœud avant d'être touchées.
+class HugePageArena : public std::pmr::memory_resource {
+public:
+    enum class Backing {
+        HUGETLB,                 // Pages de 2 Mo réservées (hugetlbfs)
+        TRANSPARENT_HUGE_PAGES,  // Pages normales + MADV_HUGEPAGE
+        REGULAR_PAGES,           // Pages normales uniquement
+        NONE                     // mmap impossible : tout passe par l'upstream
+    };
+    
+private:
+    std::byte* base_;
+    size_t capacity_;
+    size_t used_;
+    size_t overflowAllocations_;
+    Backing backing_;
+    std::pmr::memory_resource* upstream_;
+    
+public:
+    explicit HugePageArena(size_t capacity, bool useHugePages = true,
+                           std::pmr::memory_resource* upstream = std::pmr::new_delete_resource(),
+                           int numaNode = -1);
+    ~HugePageArena() override;
+    
+    HugePageArena(const HugePageArena&) = delete;
+    HugePageArena& operator=(const HugePageArena&) = delete;
+    
+    Backing getBacking() const { return backing_; }
+    size_t getCapacity() const { return capacity_; }
+    size_t getUsed() const { return used_; }
+    size_t getOverflowAllocations() const { return overflowAllocations_; }
+    
+    static const char* backingName(Backing backing);
+    
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+    
+private:
+    void prefault();
+};
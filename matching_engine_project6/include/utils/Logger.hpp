@@ -1,19 +1,131 @@
 // ===== include/utils/Logger.hpp =====
 #pragma once
-#include <iostream>
+#include "utils/SpscRing.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <string>
-#include <chrono>
-#include <iomanip>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Niveau minimal compilé (0 = DEBUG, 1 = INFO, 2 = WARNING, 3 = ERROR) : les
+// appels Logger::write d'un niveau inférieur disparaissent du binaire
+#ifndef MATCHING_ENGINE_LOG_LEVEL
+#define MATCHING_ENGINE_LOG_LEVEL 1
+#endif
+
+enum class LogLevel : uint8_t {
+    DEBUG,
+    INFO,
+    WARNING,
+    ERROR
+};
 
+constexpr LogLevel kMinLogLevel = static_cast<LogLevel>(MATCHING_ENGINE_LOG_LEVEL);
+
+// Messages des enregistrements binaires : chaque '{}' du format est remplacé
+// par l'argument suivant (formatage fait par le thread de fond)
+enum class LogFormat : uint16_t {
+    TEXT,              // Message texte libre (chemins froids)
+    ORDERS_PROCESSED,  // "Processed {} orders"
+    ORDER_REJECTED,    // "Order {} rejected (reason {})", motif OrderRejection
+    LINE_INVALID,      // "Invalid line format: insufficient fields (line {})"
+    AUCTION_UNCROSS    // "Auction uncross at {}: {} executed"
+};
+
+constexpr size_t kMaxLogArgs = 4;
+
+// Enregistrement copié tel quel dans la file du thread producteur
+struct LogRecord {
+    int64_t wallNanos;             // Horloge système à l'appel
+    uint64_t args[kMaxLogArgs];    // Bits des arguments (entiers ou double)
+    std::string* text;             // TEXT : message alloué par le producteur, libéré au formatage
+    LogFormat format;
+    LogLevel level;
+    uint8_t argCount;
+    uint8_t argKinds;              // 2 bits par argument : 0 non signé, 1 signé, 2 double
+};
+
+// Logger asynchrone : le thread appelant ne fait qu'une copie d'un
+// LogRecord dans sa propre file SPSC (sans verrou ni allocation pour les
+// formats binaires) ; un thread de fond formate et écrit les messages. Une
+// file pleine perd l'enregistrement plutôt que de bloquer le matching.
 class Logger {
 private:
+    using Ring = SpscRing<LogRecord>;
+    static constexpr size_t kRingCapacity = 4096;  // Enregistrements par thread
+    
     static std::ofstream logFile_;
-    static bool enabled_;
+    static std::atomic<bool> enabled_;
+    static std::atomic<bool> running_;
+    static std::atomic<uint64_t> dropped_;
+    static std::thread thread_;
+    static std::mutex mutex_;                    // Fichier et registre des files
+    static std::vector<std::shared_ptr<Ring>> rings_;
+    static std::atomic<size_t> ringCount_;
+    
+    static Ring& threadRing();
+    static void push(LogRecord& record);
+    static void run();
+    static size_t drain(std::vector<std::shared_ptr<Ring>>& rings);
+    static void format(const LogRecord& record);
+    
+    template<typename T>
+    static void encode(LogRecord& record, T value) {
+        static_assert(std::is_arithmetic_v<T>, "Log arguments are numeric");
+        uint64_t bits = 0;
+        uint8_t kind = 0;
+        if constexpr (std::is_floating_point_v<T>) {
+            double d = static_cast<double>(value);
+            static_assert(sizeof(d) == sizeof(bits));
+            std::memcpy(&bits, &d, sizeof(bits));
+            kind = 2;
+        } else if constexpr (std::is_signed_v<T>) {
+            bits = static_cast<uint64_t>(static_cast<int64_t>(value));
+            kind = 1;
+        } else {
+            bits = static_cast<uint64_t>(value);
+        }
+        record.args[record.argCount] = bits;
+        record.argKinds |= static_cast<uint8_t>(kind << (2 * record.argCount));
+        record.argCount++;
+    }
+    
+    static int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
     
 public:
     static void init(const std::string& filename);
-    static void enable(bool enable) { enabled_ = enable; }
-    static void log(const std::string& message);
+    static void enable(bool enable) { enabled_.store(enable, std::memory_order_relaxed); }
+    
+    // Chemin chaud : format binaire et arguments numériques
+    template<LogLevel Level = LogLevel::INFO, typename... Args>
+    static void write(LogFormat format, Args... args) {
+        if constexpr (Level >= kMinLogLevel) {
+            static_assert(sizeof...(Args) <= kMaxLogArgs, "Too many log arguments");
+            if (!enabled_.load(std::memory_order_relaxed)) return;
+            LogRecord record{};
+            record.wallNanos = now();
+            record.format = format;
+            record.level = Level;
+            (encode(record, args), ...);
+            push(record);
+        }
+    }
+    
+    // Chemin froid : message déjà construit (filtré au niveau compilé)
+    static void log(const std::string& message, LogLevel level = LogLevel::INFO);
+    
+    // Vide les files, écrit les derniers messages et arrête le thread de fond
     static void close();
+    
+    // Enregistrements perdus sur file pleine depuis le démarrage
+    static uint64_t getDroppedCount() { return dropped_.load(std::memory_order_relaxed); }
 };
@@ -0,0 +1,47 @@
+// ===== include/utils/Metrics.hpp =====
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Métriques à écrivain unique : seul le thread propriétaire les modifie, par
+// load + store relaxed (pas d'opération atomique read-modify-write sur le
+// chemin chaud) ; un thread lecteur peut les exporter à tout moment.
+class MetricCounter {
+private:
+    std::atomic<uint64_t> value_{0};
+
+public:
+    void add(uint64_t n = 1) {
+        value_.store(value_.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+    void set(uint64_t value) { value_.store(value, std::memory_order_relaxed); }
+    uint64_t get() const { return value_.load(std::memory_order_relaxed); }
+};
+
+// Histogramme de latences en nanosecondes : seaux en puissances de 2
+// (seau i : latences < 2^i ns), le dernier absorbe le reste
+class LatencyHistogram {
+public:
+    static constexpr size_t kBuckets = 32;  // Jusqu'à ~2 s
+
+private:
+    std::array<MetricCounter, kBuckets> buckets_;
+    MetricCounter count_;
+    MetricCounter sumNanos_;
+
+public:
+    void record(uint64_t nanos) {
+        size_t bucket = nanos == 0 ? 0 : 64 - static_cast<size_t>(__builtin_clzll(nanos));
+        buckets_[bucket < kBuckets ? bucket : kBuckets - 1].add();
+        count_.add();
+        sumNanos_.add(nanos);
+    }
+    
+    // Borne supérieure (exclue) du seau en nanosecondes
+    static uint64_t upperBound(size_t bucket) { return uint64_t{1} << bucket; }
+    uint64_t getBucket(size_t bucket) const { return buckets_[bucket].get(); }
+    uint64_t getCount() const { return count_.get(); }
+    uint64_t getSumNanos() const { return sumNanos_.get(); }
+};
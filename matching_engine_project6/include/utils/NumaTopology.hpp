@@ -0,0 +1,58 @@
+// ===== include/utils/NumaTopology.hpp =====
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+struct NumaNode {
+    int id = 0;
+    std::vector<int> cpus;              // CPU autorisés pour le processus (affinité)
+    uint64_t memoryBytes = 0;
+    std::vector<int> distances;         // Distances vers les nœuds, dans l'ordre de getNodes()
+};
+
+// Topologie NUMA lue dans /sys/devices/system/node (un seul nœud couvrant
+// tous les CPU si sysfs est absent), et primitives de placement par appels
+// système directs (sched_setaffinity, set_mempolicy, mbind), sans libnuma.
+// Le placement est une préférence : en cas d'échec (conteneur, nœud plein),
+// le noyau retombe sur sa politique par défaut.
+class NumaTopology {
+private:
+    std::vector<NumaNode> nodes_;
+    std::vector<int> spreadCpus_;       // CPU alternés entre nœuds (workers successifs)
+    
+public:
+    // Seuls les CPU de `allowedCpus` sont retenus (par défaut : affinité du processus)
+    explicit NumaTopology(const std::string& sysfsRoot = "/sys/devices/system/node",
+                          std::vector<int> allowedCpus = currentAffinity());
+    
+    // Topologie de la machine, détectée une fois
+    static const NumaTopology& get();
+    
+    const std::vector<NumaNode>& getNodes() const { return nodes_; }
+    bool isNuma() const { return nodes_.size() > 1; }
+    const NumaNode* findNode(int id) const;
+    int nodeOfCpu(int cpu) const;       // -1 si inconnu
+    // CPU du worker `index` : les workers successifs alternent entre nœuds
+    int cpuForWorker(size_t index) const;
+    
+    void report(std::ostream& out) const;
+    
+    // Thread appelant fixé sur les cœurs du nœud de son CPU courant, allocations
+    // préférées sur ce nœud ; rend le nœud (-1 si inconnu) et le CPU dans `cpu`
+    int pinToCurrentNode(int& cpu) const;
+    
+    // Format des listes sysfs : "0-3,8,10-11"
+    static std::vector<int> parseCpuList(const std::string& list);
+    
+    // Thread appelant
+    static std::vector<int> currentAffinity();
+    static int currentCpu();
+    static bool pinCurrentThread(const std::vector<int>& cpus);
+    // Allocations futures du thread (et des threads qu'il crée) sur `node`
+    static bool preferNode(int node);
+    // Pages de [addr, addr + bytes) sur `node`, à appeler avant de les toucher
+    static bool bindMemory(void* addr, size_t bytes, int node);
+};
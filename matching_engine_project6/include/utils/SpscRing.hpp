@@ -0,0 +1,69 @@
+// ===== include/utils/SpscRing.hpp =====
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+// File circulaire lock-free un producteur / un consommateur.
+// Capacité arrondie à la puissance de 2 supérieure ; les index producteur et
+// consommateur sont sur des lignes de cache distinctes (pas de faux partage).
+template<typename T>
+class SpscRing {
+    static_assert(std::is_trivially_copyable_v<T>, "SpscRing stores trivially copyable records");
+    
+private:
+    static constexpr size_t kCacheLine = 64;
+    
+    std::unique_ptr<T[]> buffer_;
+    size_t mask_;
+    alignas(kCacheLine) std::atomic<size_t> head_{0};  // Prochain slot à écrire (producteur)
+    alignas(kCacheLine) size_t cachedTail_{0};         // Copie locale du tail côté producteur
+    alignas(kCacheLine) std::atomic<size_t> tail_{0};  // Prochain slot à lire (consommateur)
+    alignas(kCacheLine) size_t cachedHead_{0};         // Copie locale du head côté consommateur
+    
+public:
+    explicit SpscRing(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) size <<= 1;
+        buffer_ = std::make_unique<T[]>(size);
+        mask_ = size - 1;
+    }
+    
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+    
+    // Producteur : false si la file est pleine
+    bool tryPush(const T& value) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head - cachedTail_ > mask_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head - cachedTail_ > mask_) return false;
+        }
+        buffer_[head & mask_] = value;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+    
+    // Consommateur : false si la file est vide
+    bool tryPop(T& value) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == cachedHead_) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail == cachedHead_) return false;
+        }
+        value = buffer_[tail & mask_];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+    
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+    
+    size_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+    
+    size_t capacity() const { return mask_ + 1; }
+};
@@ -0,0 +1,75 @@
+// ===== include/utils/ThreadPool.hpp =====
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Placement NUMA des workers (voir NumaTopology)
+struct ThreadPlacement {
+    enum class Mode {
+        NONE,       // Placement laissé au noyau
+        SPREAD,     // Worker i sur un cœur dédié, nœuds alternés, mémoire locale
+        NODE        // Tous les workers sur les cœurs d'un nœud, mémoire de ce nœud
+    };
+    Mode mode = Mode::NONE;
+    int node = 0;   // Mode NODE
+    
+    static ThreadPlacement spread() { return {Mode::SPREAD, 0}; }
+    static ThreadPlacement onNode(int node) { return {Mode::NODE, node}; }
+};
+
+// Pool de threads à vol de tâches : chaque worker a sa propre file, consomme
+// par l'avant et, quand elle est vide, vole par l'arrière de la file d'un autre.
+// Les tâches soumises dans l'ordre (ex. plus gros fichiers d'abord) sont donc
+// démarrées à peu près dans cet ordre, et les workers finissent ensemble.
+// En placement SPREAD, un worker vole d'abord sur son propre nœud : une tâche
+// volée alloue sa mémoire sur le nœud du voleur, qui l'exécute entièrement.
+// Les tâches ne doivent pas lever d'exception.
+class ThreadPool {
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+    
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> workers_;
+    std::vector<int> workerNodes_;          // Nœud NUMA de chaque worker (-1 sans placement)
+    
+    std::mutex mutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable allDone_;
+    size_t queued_ = 0;   // Tâches en attente dans les files
+    size_t pending_ = 0;  // Tâches soumises et non terminées
+    bool stop_ = false;
+    
+    std::atomic<size_t> nextQueue_{0};
+    std::atomic<size_t> steals_{0};
+    
+    void place(size_t index, const ThreadPlacement& placement);
+    void workerLoop(size_t index);
+    bool popLocal(size_t index, std::function<void()>& task);
+    bool steal(size_t index, std::function<void()>& task);
+    
+public:
+    explicit ThreadPool(size_t threads = std::thread::hardware_concurrency(),
+                        const ThreadPlacement& placement = {});
+    ~ThreadPool();
+    
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    
+    // Répartition round-robin entre les files des workers
+    void submit(std::function<void()> task);
+    // Bloque jusqu'à ce que toutes les tâches soumises soient terminées
+    void wait();
+    
+    size_t size() const { return workers_.size(); }
+    size_t getStealCount() const { return steals_.load(std::memory_order_relaxed); }
+    int getWorkerNode(size_t index) const { return workerNodes_[index]; }
+};
@@ -0,0 +1,205 @@
+// ===== load_generator.cpp =====
+// Client de charge de la passerelle d'ordres (matching_engine --serve) :
+// envoie des ordres aléatoires avec un nombre borné d'ordres en vol et
+// mesure la latence aller-retour (envoi -> premier événement de l'ordre),
+// ou s'abonne au drop copy et compte les événements reçus.
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <unordered_map>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "io/GatewayProtocol.hpp"
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+    
+    int connectTo(const std::string& endpoint) {
+        if (endpoint.rfind("unix:", 0) == 0) {
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            std::string path = endpoint.substr(5);
+            std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+            int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd >= 0 && ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) return fd;
+            if (fd >= 0) ::close(fd);
+            return -1;
+        }
+        if (endpoint.rfind("tcp:", 0) == 0) {
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = htons(static_cast<uint16_t>(std::stoul(endpoint.substr(4))));
+            int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+            if (fd >= 0 && ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+                int noDelay = 1;
+                ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+                return fd;
+            }
+            if (fd >= 0) ::close(fd);
+        }
+        return -1;
+    }
+    
+    bool sendAll(int fd, const void* data, size_t size) {
+        const char* bytes = static_cast<const char*>(data);
+        while (size > 0) {
+            ssize_t sent = ::send(fd, bytes, size, MSG_NOSIGNAL);
+            if (sent <= 0) return false;
+            bytes += sent;
+            size -= static_cast<size_t>(sent);
+        }
+        return true;
+    }
+    
+    // Lit au moins un événement complet ; `pending` garde un reste partiel
+    template<typename Fn>
+    bool receiveEvents(int fd, std::vector<char>& pending, Fn&& onEvent) {
+        char buffer[1 << 16];
+        ssize_t received = ::recv(fd, buffer, sizeof(buffer), 0);
+        if (received <= 0) return false;
+        pending.insert(pending.end(), buffer, buffer + received);
+        size_t offset = 0;
+        while (pending.size() - offset >= sizeof(GatewayEvent)) {
+            GatewayEvent event;
+            std::memcpy(&event, pending.data() + offset, sizeof(event));
+            onEvent(event);
+            offset += sizeof(GatewayEvent);
+        }
+        pending.erase(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(offset));
+        return true;
+    }
+    
+    void printUsage(const char* program) {
+        std::cerr << "Usage: " << program << " <unix:path | tcp:port> [options]\n"
+                  << "Options:\n"
+                  << "  --orders N       Orders to send (default 100000)\n"
+                  << "  --instruments K  Spread orders over K instruments (default 1)\n"
+                  << "  --window W       Orders in flight before waiting for events (default 64)\n"
+                  << "  --cancel-ratio R Fraction of actions that cancel an earlier order (default 0.1)\n"
+                  << "  --subscribe      Drop-copy mode: count events until the gateway closes"
+                  << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    
+    std::string endpoint = argv[1];
+    size_t orders = 100000;
+    size_t instruments = 1;
+    size_t window = 64;
+    double cancelRatio = 0.1;
+    bool subscribe = false;
+    for (int i = 2; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option == "--orders" && i + 1 < argc) {
+            orders = std::stoull(argv[++i]);
+        } else if (option == "--instruments" && i + 1 < argc) {
+            instruments = std::max<size_t>(std::stoull(argv[++i]), 1);
+        } else if (option == "--window" && i + 1 < argc) {
+            window = std::max<size_t>(std::stoull(argv[++i]), 1);
+        } else if (option == "--cancel-ratio" && i + 1 < argc) {
+            cancelRatio = std::stod(argv[++i]);
+        } else if (option == "--subscribe") {
+            subscribe = true;
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    
+    int fd = connectTo(endpoint);
+    if (fd < 0) {
+        std::cerr << "Cannot connect to " << endpoint << std::endl;
+        return 1;
+    }
+    
+    std::vector<char> pending;
+    if (subscribe) {
+        GatewaySubscribe message{gatewayHeader<GatewaySubscribe>(GatewayMessageType::SUBSCRIBE), 0};
+        sendAll(fd, &message, sizeof(message));
+        uint64_t events = 0;
+        auto start = Clock::now();
+        while (receiveEvents(fd, pending, [&](const GatewayEvent&) { events++; })) {}
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        std::cout << "Drop copy: " << events << " events in " << seconds << " s" << std::endl;
+        ::close(fd);
+        return 0;
+    }
+    
+    // Latence d'un NEW : jusqu'au premier événement portant son identifiant
+    std::unordered_map<OrderId, Clock::time_point> inFlight;
+    std::vector<double> latencies;
+    latencies.reserve(orders);
+    uint64_t events = 0;
+    auto onEvent = [&](const GatewayEvent& event) {
+        events++;
+        auto it = inFlight.find(event.orderId);
+        if (it != inFlight.end() && event.action == static_cast<uint8_t>(Action::NEW)) {
+            latencies.push_back(std::chrono::duration<double, std::micro>(Clock::now() - it->second).count());
+            inFlight.erase(it);
+        }
+    };
+    
+    std::mt19937_64 random(42);
+    std::vector<std::string> symbols;
+    for (size_t i = 0; i < instruments; ++i) {
+        symbols.push_back("SYM" + std::to_string(i));
+    }
+    
+    auto start = Clock::now();
+    OrderId nextId = 1;
+    GatewayOrder message;
+    for (size_t sent = 0; sent < orders; ++sent) {
+        while (inFlight.size() >= window) {
+            if (!receiveEvents(fd, pending, onEvent)) {
+                std::cerr << "Gateway closed the connection" << std::endl;
+                return 1;
+            }
+        }
+        
+        const std::string& symbol = symbols[random() % symbols.size()];
+        bool cancel = nextId > 1 && std::uniform_real_distribution<double>(0, 1)(random) < cancelRatio;
+        if (cancel) {
+            OrderId target = random() % (nextId - 1) + 1;
+            encodeGatewayOrder(message, 0, target, symbol, Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL);
+        } else {
+            Side side = random() % 2 ? Side::BUY : Side::SELL;
+            Price price = 99.0 + static_cast<double>(random() % 200) / 100.0;
+            encodeGatewayOrder(message, 0, nextId, symbol, side, OrderType::LIMIT,
+                               random() % 100 + 1, price, Action::NEW);
+            inFlight.emplace(nextId++, Clock::now());
+        }
+        if (!sendAll(fd, &message, sizeof(message))) {
+            std::cerr << "Send failed" << std::endl;
+            return 1;
+        }
+    }
+    while (!inFlight.empty() && receiveEvents(fd, pending, onEvent)) {}
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    ::close(fd);
+    
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) {
+        return latencies.empty() ? 0.0 : latencies[static_cast<size_t>(p * (latencies.size() - 1))];
+    };
+    std::cout << "=== Load Generator ===" << std::endl;
+    std::cout << "Actions sent: " << orders << " in " << seconds << " s ("
+              << static_cast<uint64_t>(orders / seconds) << " actions/s)" << std::endl;
+    std::cout << "Events received: " << events << std::endl;
+    std::cout << "Round-trip latency (us): p50 " << percentile(0.5) << ", p99 " << percentile(0.99)
+              << ", max " << percentile(1.0) << std::endl;
+    return 0;
+}
@@ -1,133 +1,400 @@
 // ===== main.cpp =====
 #include <iostream>
 #include <string>
-#include <chrono>
+#include <vector>
+#include <csignal>
+#include <filesystem>
+#include <memory>
+#include "io/Session.hpp"
+#include "io/BatchRunner.hpp"
+#include "io/OrderParser.hpp"
+#include "io/OrderGateway.hpp"
+#include "io/JournalReader.hpp"
+#include "io/JournalWriter.hpp"
+#include "io/MetricsExporter.hpp"
 #include "core/InstrumentManager.hpp"
-#include "io/CSVReader.hpp"
-#include "io/CSVWriter.hpp"
 #include "exceptions/Exceptions.hpp"
 #include "utils/Logger.hpp"
+#include "utils/NumaTopology.hpp"
 
-// Fonctions de parsing
-Side parseSide(const std::string& str) {
-    if (str == "BUY") return Side::BUY;
-    if (str == "SELL") return Side::SELL;
-    throw std::invalid_argument("Invalid side: " + str);
+// Format : <instruments>:<ordres par carnet>:<niveaux par côté>
+CapacityConfig parseCapacity(const std::string& str) {
+    CapacityConfig config;
+    size_t first = str.find(':');
+    size_t second = str.find(':', first + 1);
+    if (first == std::string::npos || second == std::string::npos) {
+        throw std::invalid_argument("Invalid capacity: " + str);
+    }
+    config.instruments = std::stoull(str.substr(0, first));
+    config.ordersPerBook = std::stoull(str.substr(first + 1, second - first - 1));
+    config.levelsPerSide = std::stoull(str.substr(second + 1));
+    return config;
 }
 
-OrderType parseOrderType(const std::string& str) {
-    if (str == "LIMIT") return OrderType::LIMIT;
-    if (str == "MARKET") return OrderType::MARKET;
-    throw std::invalid_argument("Invalid order type: " + str);
+std::vector<std::string> splitColons(const std::string& str) {
+    std::vector<std::string> parts;
+    size_t start = 0;
+    for (size_t colon; (colon = str.find(':', start)) != std::string::npos; start = colon + 1) {
+        parts.push_back(str.substr(start, colon - start));
+    }
+    parts.push_back(str.substr(start));
+    return parts;
 }
 
-Action parseAction(const std::string& str) {
-    if (str == "NEW") return Action::NEW;
-    if (str == "MODIFY") return Action::MODIFY;
-    if (str == "CANCEL") return Action::CANCEL;
-    throw std::invalid_argument("Invalid action: " + str);
+// Format : <taille max>:<collier>:<position max>:<notionnel ouvert max> (0 = désactivé)
+RiskLimits parseRiskLimits(const std::string& str) {
+    std::vector<std::string> parts = splitColons(str);
+    if (parts.size() != 4) {
+        throw std::invalid_argument("Invalid risk limits (expected Q:C:P:N): " + str);
+    }
+    RiskLimits limits;
+    limits.maxOrderQuantity = std::stoull(parts[0]);
+    limits.priceCollar = std::stod(parts[1]);
+    limits.maxPosition = std::stoull(parts[2]);
+    limits.maxOpenNotional = std::stod(parts[3]);
+    return limits;
 }
 
-// Fonction pour parser le prix avec gestion spéciale des ordres MARKET
-Price parsePrice(const std::string& str, OrderType type) {
-    // Pour les ordres MARKET, toujours retourner 0 peu importe la valeur
-    if (type == OrderType::MARKET) {
-        return 0.0;
+// Format : <symbole>=<bande>:<niveaux max>:<suspension ns>, bande en
+// pourcentage si suffixée par '%', largeur de prix absolue sinon (0 = désactivé)
+std::pair<std::string, PriceBand> parsePriceBand(const std::string& str) {
+    size_t equals = str.find('=');
+    std::vector<std::string> parts = splitColons(equals == std::string::npos ? "" : str.substr(equals + 1));
+    if (equals == std::string::npos || parts.size() != 3 || parts[0].empty()) {
+        throw std::invalid_argument("Invalid price band (expected SYMBOL=BAND:LEVELS:HALT): " + str);
     }
+    PriceBand band;
+    if (parts[0].back() == '%') {
+        band.percent = std::stod(parts[0].substr(0, parts[0].size() - 1)) / 100.0;
+    } else {
+        band.width = std::stod(parts[0]);
+    }
+    band.maxLevels = std::stoull(parts[1]);
+    band.haltDuration = std::stoull(parts[2]);
+    return {str.substr(0, equals), band};
+}
+
+IoBackend parseIoBackend(const std::string& str) {
+    if (str == "sync") return IoBackend::SYNC;
+    if (str == "uring") return IoBackend::URING;
+    throw std::invalid_argument("Invalid I/O backend (expected sync or uring): " + str);
+}
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " <input.csv> <output.csv> [options]\n"
+              << "       " << program << " --batch <output_dir> [--threads N] [options] <input files or globs...>\n"
+              << "       " << program << " --serve <unix:path | tcp:port> [options]\n"
+              << "Options:\n"
+              << "  --capacity I:O:L   Pre-allocate for I instruments, O orders per book, L levels per side\n"
+              << "  --hugepages        Back the pre-allocated arena with huge pages when available\n"
+              << "  --snapshot-in F    Restore books from snapshot F and replay only the input tail\n"
+              << "  --snapshot-out F   Write a snapshot of all books to F at the end of the run\n"
+              << "  --snapshot-every N Also write the snapshot every N input lines\n"
+              << "  --journal F        Write-ahead journal of order actions (group commit)\n"
+              << "  --group-commit N:T fsync the journal every N records or T microseconds (default 256:1000)\n"
+              << "  --recover          Rebuild state from the journal (after --snapshot-in) and append to it\n"
+              << "  --parse-threads N  Parse the input in newline-aligned chunks on N threads (matching stays sequential)\n"
+              << "  --io B             CSV file I/O backend: sync (pread/pwrite, default) or uring (io_uring reads\n"
+              << "                     ahead of the parser and asynchronous output buffers, sync when unavailable)\n"
+              << "  --io-blocks N:K    Reads in flight / output buffers and their size in KiB (default 4:1024)\n"
+              << "  --numa             NUMA placement: allocate each session (or the gateway) on the node of its\n"
+              << "                     thread and pin that thread to its core; batch workers get one core each,\n"
+              << "                     alternating nodes. Prints the topology at startup\n"
+              << "  --opening-auction T  Accumulate orders without matching until timestamp T, then uncross\n"
+              << "  --closing-auction T  Switch to a call auction at timestamp T and uncross at the end of input\n"
+              << "  --auction-threads N  Uncross instruments in parallel on N threads\n"
+              << "  --allocation S=P   Allocation policy P (FIFO, PRO_RATA, TOP_PRO_RATA) for instrument S (repeatable)\n"
+              << "  --risk Q:C:P:N     Pre-trade checks: max order quantity, price collar (fraction of the best\n"
+              << "                     opposite price), max net position and max open notional per owner (0 = off)\n"
+              << "  --price-band S=B:L:H  Sweep protection for instrument S (repeatable): band B around the last\n"
+              << "                     trade (B% or absolute width), at most L levels per order, halt for H ns\n"
+              << "                     when the band is hit (0 = off)\n"
+              << "  --events M         Execution events: FULL (both sides of every fill), AGGREGATED (one\n"
+              << "                     aggressor summary per price level plus passive fills) or TRADES (the\n"
+              << "                     output file holds one line per trade instead of order events)\n"
+              << "  --metrics T        Export Prometheus metrics to file T (rewritten periodically) or serve\n"
+              << "                     them on a Unix socket with T = unix:<path> (single-file mode only)\n"
+              << "  --metrics-interval MS  File export period in milliseconds (default 1000)\n"
+              << "Batch mode runs one independent session per input file on a work-stealing\n"
+              << "thread pool (largest files first) and writes <output_dir>/batch_report.csv.\n"
+              << "  --threads N        Worker threads (default: one per core)\n"
+              << "Serve mode accepts binary order messages on a Unix socket or loopback TCP port\n"
+              << "and streams the resulting events back to the sender and to drop-copy subscribers\n"
+              << "until SIGINT/SIGTERM (--events FULL or AGGREGATED; --journal, --recover, --risk,\n"
+              << "--price-band, --allocation and --metrics apply; snapshots are not supported)."
+              << std::endl;
+}
+
+// Options communes au mode fichier unique et au mode batch.
+// Retourne false sur une option inconnue ; les arguments libres vont dans `positional`.
+bool parseOptions(int argc, char* argv[], int first, SessionOptions& options,
+                  size_t& threads, std::vector<std::string>& positional) {
+    bool useHugePages = false;
     
-    // Pour les ordres LIMIT, parser normalement
-    try {
-        if (str.empty() || str == "na" || str == "NA" || str == "null" || str == "NULL") {
-            throw std::invalid_argument("Invalid price for LIMIT order");
+    for (int i = first; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option == "--capacity" && i + 1 < argc) {
+            options.capacity = parseCapacity(argv[++i]);
+        } else if (option == "--hugepages") {
+            useHugePages = true;
+        } else if (option == "--snapshot-in" && i + 1 < argc) {
+            options.snapshotIn = argv[++i];
+        } else if (option == "--snapshot-out" && i + 1 < argc) {
+            options.snapshotOut = argv[++i];
+        } else if (option == "--snapshot-every" && i + 1 < argc) {
+            options.snapshotEvery = std::stoull(argv[++i]);
+        } else if (option == "--journal" && i + 1 < argc) {
+            options.journalFile = argv[++i];
+        } else if (option == "--group-commit" && i + 1 < argc) {
+            std::string value = argv[++i];
+            size_t colon = value.find(':');
+            options.journalConfig.groupCommitRecords = std::stoull(value.substr(0, colon));
+            if (colon != std::string::npos) {
+                options.journalConfig.groupCommitMicros = std::stoull(value.substr(colon + 1));
+            }
+        } else if (option == "--recover") {
+            options.recover = true;
+        } else if (option == "--parse-threads" && i + 1 < argc) {
+            options.parseThreads = std::stoull(argv[++i]);
+        } else if (option == "--io" && i + 1 < argc) {
+            options.io.backend = parseIoBackend(argv[++i]);
+        } else if (option == "--io-blocks" && i + 1 < argc) {
+            std::string value = argv[++i];
+            size_t colon = value.find(':');
+            options.io.depth = std::max<size_t>(std::stoull(value.substr(0, colon)), 1);
+            if (colon != std::string::npos) {
+                options.io.blockBytes = std::max<size_t>(std::stoull(value.substr(colon + 1)), 1) << 10;
+            }
+        } else if (option == "--numa") {
+            options.numa = true;
+        } else if (option == "--opening-auction" && i + 1 < argc) {
+            options.openingAuctionEnd = std::stoull(argv[++i]);
+        } else if (option == "--closing-auction" && i + 1 < argc) {
+            options.closingAuctionStart = std::stoull(argv[++i]);
+        } else if (option == "--auction-threads" && i + 1 < argc) {
+            options.auctionThreads = std::stoull(argv[++i]);
+        } else if (option == "--allocation" && i + 1 < argc) {
+            std::string value = argv[++i];
+            size_t equals = value.find('=');
+            if (equals == std::string::npos) {
+                throw std::invalid_argument("Invalid allocation (expected SYMBOL=POLICY): " + value);
+            }
+            options.allocationPolicies.emplace_back(value.substr(0, equals),
+                                                    parseAllocationPolicy(value.substr(equals + 1)));
+        } else if (option == "--risk" && i + 1 < argc) {
+            options.riskLimits = parseRiskLimits(argv[++i]);
+        } else if (option == "--price-band" && i + 1 < argc) {
+            options.priceBands.push_back(parsePriceBand(argv[++i]));
+        } else if (option == "--events" && i + 1 < argc) {
+            options.eventMode = parseEventMode(argv[++i]);
+        } else if (option == "--metrics" && i + 1 < argc) {
+            options.metricsTarget = argv[++i];
+        } else if (option == "--metrics-interval" && i + 1 < argc) {
+            options.metricsIntervalMillis = std::stoull(argv[++i]);
+        } else if (option == "--threads" && i + 1 < argc) {
+            threads = std::stoull(argv[++i]);
+        } else if (option.rfind("--", 0) == 0) {
+            return false;
+        } else {
+            positional.push_back(option);
+        }
+    }
+    options.capacity.useHugePages = useHugePages;
+    return true;
+}
+
+int runBatch(const std::string& outputDir, const std::vector<std::string>& patterns,
+             const SessionOptions& options, size_t threads) {
+    BatchOptions batch;
+    batch.outputDir = outputDir;
+    batch.threads = threads;
+    batch.session = options;
+    
+    std::vector<std::string> inputs = BatchRunner::expandInputs(patterns);
+    Logger::log("Batch run over " + std::to_string(inputs.size()) + " input files");
+    
+    BatchReport report = BatchRunner::run(inputs, batch);
+    BatchRunner::printReport(report, std::cout);
+    BatchRunner::writeReportCSV(report,
+        (std::filesystem::path(outputDir) / "batch_report.csv").string());
+    
+    return report.getFailureCount() == 0 ? 0 : 1;
+}
+
+// Passerelle active, arrêtée par SIGINT/SIGTERM (stop() est async-signal-safe)
+OrderGateway* activeGateway = nullptr;
+
+extern "C" void stopGateway(int) {
+    if (activeGateway) activeGateway->stop();
+}
+
+int runServe(const std::string& endpoint, const SessionOptions& options) {
+    if (options.eventMode == EventMode::TRADES) {
+        std::cerr << "Serve mode streams order events: use --events FULL or AGGREGATED" << std::endl;
+        return 1;
+    }
+    // Les snapshots sont positionnés sur les lignes d'un fichier d'entrée,
+    // que la passerelle n'a pas : seule la reprise sur journal s'applique
+    if (!options.snapshotIn.empty() || !options.snapshotOut.empty()) {
+        std::cerr << "Serve mode has no input position: --snapshot-in and --snapshot-out are not supported, "
+                  << "use --journal with --recover" << std::endl;
+        return 1;
+    }
+    if (options.recover && options.journalFile.empty()) {
+        std::cerr << "--recover requires --journal" << std::endl;
+        return 1;
+    }
+    
+    // Même placement qu'une session : état alloué sur le nœud du thread de la
+    // boucle epoll, thread fixé sur son cœur une fois les threads annexes créés
+    int numaNode = -1;
+    int numaCpu = -1;
+    if (options.numa) {
+        numaNode = NumaTopology::get().pinToCurrentNode(numaCpu);
+    }
+    
+    InstrumentManager manager;
+    manager.setRiskLimits(options.riskLimits);
+    manager.setEventMode(options.eventMode);
+    for (const auto& [instrument, policy] : options.allocationPolicies) {
+        manager.setAllocationPolicy(instrument, policy);
+    }
+    for (const auto& [instrument, band] : options.priceBands) {
+        manager.setPriceBand(instrument, band);
+    }
+    
+    // Reprise comme Session::run : rejouer le journal (configuration des
+    // instruments déjà en place) puis le compléter au lieu de le tronquer
+    std::unique_ptr<JournalWriter> journal;
+    uint64_t journalRecords = 0;
+    if (options.recover) {
+        JournalRecovery recovery = JournalReader::recover(options.journalFile, manager);
+        journalRecords = recovery.records;
+        Logger::log("Recovered journal " + options.journalFile + ": " + std::to_string(recovery.applied) +
+                    " actions replayed" + (recovery.tornTail ? ", torn tail truncated" : ""));
+        std::cout << "Recovered " << recovery.applied << " journaled actions" << std::endl;
+        
+        // Les événements du rejeu ont déjà été transmis avant l'arrêt
+        std::vector<std::string> instruments;
+        manager.forEachEngine([&](const std::string& instrument, const MatchingEngine&) {
+            instruments.push_back(instrument);
+        });
+        for (const std::string& instrument : instruments) {
+            manager.getOrCreateEngine(instrument).discardEvents();
         }
-        return std::stod(str);
-    } catch (...) {
-        throw std::invalid_argument("Invalid price: " + str);
     }
+    if (!options.journalFile.empty()) {
+        journal = std::make_unique<JournalWriter>(options.journalFile, options.journalConfig,
+                                                  journalRecords);
+        manager.setJournal(journal.get());
+    }
+    PipelineMetrics pipelineMetrics;
+    std::unique_ptr<MetricsExporter> metricsExporter;
+    if (!options.metricsTarget.empty()) {
+        metricsExporter = std::make_unique<MetricsExporter>(
+            options.metricsTarget, options.metricsIntervalMillis, manager, pipelineMetrics);
+    }
+    
+    GatewayConfig config;
+    config.endpoint = endpoint;
+    OrderGateway gateway(manager, config);
+    activeGateway = &gateway;
+    std::signal(SIGINT, stopGateway);
+    std::signal(SIGTERM, stopGateway);
+    
+    std::cout << "Listening on " << endpoint;
+    if (gateway.getPort() != 0) std::cout << " (port " << gateway.getPort() << ")";
+    std::cout << std::endl;
+    Logger::log("Gateway listening on " + endpoint);
+    if (numaNode >= 0) {
+        NumaTopology::pinCurrentThread({numaCpu});
+        std::cout << "NUMA node: " << numaNode << ", CPU " << numaCpu << std::endl;
+    }
+    
+    gateway.run();
+    activeGateway = nullptr;
+    if (journal) {
+        journal->flush();
+        manager.setJournal(nullptr);
+    }
+    
+    const GatewayStats& stats = gateway.getStats();
+    std::cout << "=== Gateway Statistics ===" << std::endl;
+    std::cout << "Connections: " << stats.connections << std::endl;
+    std::cout << "Orders received: " << stats.messages << std::endl;
+    std::cout << "Events sent: " << stats.events << std::endl;
+    std::cout << "Protocol errors: " << stats.protocolErrors << std::endl;
+    std::cout << "Slow consumers disconnected: " << stats.slowConsumers << std::endl;
+    return 0;
 }
 
 int main(int argc, char* argv[]) {
-    if (argc != 3) {
-        std::cerr << "Usage: " << argv[0] << " <input.csv> <output.csv>" << std::endl;
+    if (argc < 3) {
+        printUsage(argv[0]);
         return 1;
     }
     
-    std::string inputFile = argv[1];
-    std::string outputFile = argv[2];
+    const bool batchMode = std::string(argv[1]) == "--batch";
+    const bool serveMode = std::string(argv[1]) == "--serve";
+    SessionOptions options;
+    size_t threads = 0;
+    std::vector<std::string> positional;
+    
+    // Valeur d'option invalide (capacité, politique d'allocation...) : usage
+    bool parsed = false;
+    try {
+        parsed = parseOptions(argc, argv, 3, options, threads, positional);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+    }
+    if (!parsed || (batchMode && positional.empty()) || (!batchMode && !positional.empty())) {
+        printUsage(argv[0]);
+        return 1;
+    }
     
     try {
         // Initialiser le logger
         Logger::init("matching_engine.log");
         Logger::log("Starting Matching Engine");
+        if (options.numa) {
+            const NumaTopology& topology = NumaTopology::get();
+            topology.report(std::cout);
+            Logger::log("NUMA topology: " + std::to_string(topology.getNodes().size()) + " nodes");
+        }
         
-        // Mesurer le temps de traitement
-        auto startTime = std::chrono::high_resolution_clock::now();
-        
-        // Initialiser les composants
-        InstrumentManager manager;
-        CSVReader reader(inputFile);
-        CSVWriter writer(outputFile);
-        
-        writer.writeHeader();
-        
-        size_t orderCount = 0;
-        size_t errorCount = 0;
-        
-        // Traiter chaque ligne du fichier
-        reader.readLine([&](const std::vector<std::string>& fields) {
-            if (fields.size() < 8) {
-                errorCount++;
-                Logger::log("Invalid line format: insufficient fields");
-                return;
-            }
-            
-            try {
-                // Parser les champs
-                Timestamp timestamp = std::stoull(fields[0]);
-                OrderId orderId = std::stoull(fields[1]);
-                std::string instrument = fields[2];
-                Side side = parseSide(fields[3]);
-                OrderType type = parseOrderType(fields[4]);
-                Quantity quantity = std::stoull(fields[5]);
-                // Utiliser la fonction parsePrice qui gère les ordres MARKET
-                Price price = parsePrice(fields[6], type);
-                Action action = parseAction(fields[7]);
-                
-                // Traiter l'ordre
-                manager.processOrder(timestamp, orderId, instrument, 
-                                   side, type, quantity, price, action);
-                
-                orderCount++;
-                
-                // Log périodique
-                if (orderCount % 10000 == 0) {
-                    Logger::log("Processed " + std::to_string(orderCount) + " orders");
-                }
-                
-            } catch (const std::exception& e) {
-                errorCount++;
-                Logger::log("Error processing order: " + std::string(e.what()));
-            }
-        });
-        
-        // Écrire tous les événements dans le fichier de sortie
-        auto allEvents = manager.getAllEvents();
+        if (serveMode) {
+            int status = runServe(argv[2], options);
+            Logger::log("Matching Engine gateway stopped");
+            Logger::close();
+            return status;
+        }
         
-        for (const auto& event : allEvents) {
-            writer.writeEvent(event);
+        if (batchMode) {
+            int status = runBatch(argv[2], positional, options, threads);
+            Logger::log("Matching Engine batch completed");
+            Logger::close();
+            return status;
         }
         
-        // Mesurer le temps final
-        auto endTime = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::seconds>(endTime - startTime);
+        SessionStats stats = Session::run(argv[1], argv[2], options);
+        long seconds = static_cast<long>(stats.seconds);
         
         // Afficher les statistiques
         std::cout << "=== Matching Engine Statistics ===" << std::endl;
-        std::cout << "Total orders processed: " << orderCount << std::endl;
-        std::cout << "Total events generated: " << allEvents.size() << std::endl;
-        std::cout << "Total errors: " << errorCount << std::endl;
-        std::cout << "Total execution time: " << duration.count() << " seconds" << std::endl;
-        std::cout << "Orders per second: " << (orderCount / (duration.count() + 1)) << std::endl;
+        std::cout << "Total orders processed: " << stats.orderCount << std::endl;
+        std::cout << "Total events generated: " << stats.eventCount << std::endl;
+        std::cout << "Total errors: " << stats.errorCount << std::endl;
+        std::cout << "Total rejected: " << stats.rejectCount << std::endl;
+        std::cout << "Total execution time: " << seconds << " seconds" << std::endl;
+        std::cout << "Orders per second: " << (stats.orderCount / (seconds + 1)) << std::endl;
+        if (stats.numaNode >= 0) {
+            std::cout << "NUMA node: " << stats.numaNode << std::endl;
+        }
+        if (stats.hasArena) {
+            std::cout << "Arena: " << stats.arenaBacking
+                      << ", " << stats.arenaUsed << "/" << stats.arenaCapacity << " bytes used, "
+                      << stats.arenaOverflow << " overflow allocations" << std::endl;
+        }
         
         Logger::log("Matching Engine completed successfully");
         Logger::close();
@@ -0,0 +1,222 @@
+// ===== src/core/BookView.cpp =====
+#include "core/BookView.hpp"
+#include "core/Order.hpp"
+#include "core/OrderBook.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace {
+    uint32_t packKind(Side side, OrderType type, OrderStatus status) {
+        return static_cast<uint32_t>(side) | static_cast<uint32_t>(type) << 8 |
+               static_cast<uint32_t>(status) << 16;
+    }
+    
+    bool isTerminal(uint32_t kind) {
+        auto status = static_cast<OrderStatus>((kind >> 16) & 0xFF);
+        return status == OrderStatus::EXECUTED || status == OrderStatus::CANCELED ||
+               status == OrderStatus::REJECTED;
+    }
+    
+    template<typename BookSideType>
+    void copyLevels(const BookSideType& side, size_t depth, std::vector<LevelView>& out) {
+        out.clear();
+        for (const auto& [price, level] : side) {
+            if (out.size() == depth) break;
+            out.push_back({price, level.getTotalQuantity(), level.getOrderCount()});
+        }
+    }
+}
+
+BookView::BookView(const BookViewConfig& config)
+    : depth_(config.depth), orderMask_(0), probeLimit_(0) {
+    for (size_t i = 0; i < kMaxReaders + 2; ++i) {
+        auto buffer = std::make_unique<DepthBuffer>();
+        buffer->view.bids.reserve(depth_);
+        buffer->view.asks.reserve(depth_);
+        buffers_.push_back(std::move(buffer));
+    }
+    current_.store(buffers_[0].get());
+    
+    size_t capacity = 1;
+    while (capacity < config.orderSlots) capacity <<= 1;
+    orders_ = std::make_unique<OrderSlot[]>(capacity);
+    orderMask_ = capacity - 1;
+    probeLimit_ = std::min(kProbeLimit, capacity);
+}
+
+BookView::DepthBuffer* BookView::acquireBuffer() {
+    // Tampons annoncés par les lecteurs, lus après le remplacement du courant
+    std::array<const DepthBuffer*, kMaxReaders> hazards;
+    for (size_t i = 0; i < kMaxReaders; ++i) {
+        hazards[i] = readers_[i].hazard.load();
+    }
+    
+    DepthBuffer* current = current_.load(std::memory_order_relaxed);
+    for (auto& buffer : buffers_) {
+        if (buffer.get() != current &&
+            std::find(hazards.begin(), hazards.end(), buffer.get()) == hazards.end()) {
+            return buffer.get();
+        }
+    }
+    return nullptr;  // Impossible : plus de tampons que de lecteurs plus le courant
+}
+
+void BookView::publishBook(const OrderBook& book) {
+    version_++;
+    
+    // Profondeur : remplie hors de vue des lecteurs puis publiée
+    DepthBuffer* buffer = acquireBuffer();
+    buffer->view.version = version_;
+    copyLevels(book.getBids(), depth_, buffer->view.bids);
+    copyLevels(book.getAsks(), depth_, buffer->view.asks);
+    current_.store(buffer);
+    
+    // Meilleur niveau sous seqlock
+    const PriceLevel* bid = book.getBids().getBestLevel();
+    const PriceLevel* ask = book.getAsks().getBestLevel();
+    uint64_t sequence = top_.sequence.load(std::memory_order_relaxed);
+    top_.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    top_.version.store(version_, std::memory_order_relaxed);
+    top_.bidPrice.store(bid ? bid->getPrice() : 0, std::memory_order_relaxed);
+    top_.bidQuantity.store(bid ? bid->getTotalQuantity() : 0, std::memory_order_relaxed);
+    top_.bidOrders.store(bid ? bid->getOrderCount() : 0, std::memory_order_relaxed);
+    top_.askPrice.store(ask ? ask->getPrice() : 0, std::memory_order_relaxed);
+    top_.askQuantity.store(ask ? ask->getTotalQuantity() : 0, std::memory_order_relaxed);
+    top_.askOrders.store(ask ? ask->getOrderCount() : 0, std::memory_order_relaxed);
+    top_.lastTradePrice.store(book.getLastTradePrice(), std::memory_order_relaxed);
+    top_.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+size_t BookView::slotIndex(OrderId orderId) const {
+    return static_cast<size_t>(orderId * 0x9E3779B97F4A7C15ULL) & orderMask_;
+}
+
+void BookView::publishOrder(const Order& order) {
+    OrderId orderId = order.getOrderId();
+    
+    // Entrée de l'ordre s'il est connu, sinon la première entrée jamais
+    // utilisée ou d'ordre terminé. Une entrée n'est jamais vidée : la
+    // recherche d'un ordre peut s'arrêter à la première entrée vide
+    size_t index = slotIndex(orderId);
+    OrderSlot* target = nullptr;
+    for (size_t probes = 0; probes < probeLimit_; ++probes, index = (index + 1) & orderMask_) {
+        OrderSlot& slot = orders_[index];
+        OrderId present = slot.orderId.load(std::memory_order_relaxed);
+        if (present == orderId) {
+            target = &slot;
+            break;
+        }
+        if (present == 0) {
+            if (!target) target = &slot;
+            break;
+        }
+        if (!target && isTerminal(slot.kind.load(std::memory_order_relaxed))) target = &slot;
+    }
+    if (!target) {
+        overflow_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    
+    // L'identifiant est écrit sous le seqlock : un lecteur ne mélange pas
+    // l'ordre remplacé et le nouveau
+    OrderSlot& slot = *target;
+    uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.orderId.store(orderId, std::memory_order_relaxed);
+    slot.kind.store(packKind(order.getSide(), order.getType(), order.getStatus()), std::memory_order_relaxed);
+    slot.price.store(order.getPrice(), std::memory_order_relaxed);
+    slot.quantity.store(order.getQuantity(), std::memory_order_relaxed);
+    slot.remainingQuantity.store(order.getRemainingQuantity(), std::memory_order_relaxed);
+    slot.executedQuantity.store(order.getExecutedQuantity(), std::memory_order_relaxed);
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+TopOfBook BookView::getTopOfBook() const {
+    TopOfBook top;
+    while (true) {
+        uint64_t before = top_.sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            std::this_thread::yield();
+            continue;
+        }
+        top.version = top_.version.load(std::memory_order_relaxed);
+        top.bidPrice = top_.bidPrice.load(std::memory_order_relaxed);
+        top.bidQuantity = top_.bidQuantity.load(std::memory_order_relaxed);
+        top.bidOrders = top_.bidOrders.load(std::memory_order_relaxed);
+        top.askPrice = top_.askPrice.load(std::memory_order_relaxed);
+        top.askQuantity = top_.askQuantity.load(std::memory_order_relaxed);
+        top.askOrders = top_.askOrders.load(std::memory_order_relaxed);
+        top.lastTradePrice = top_.lastTradePrice.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (top_.sequence.load(std::memory_order_relaxed) == before) return top;
+    }
+}
+
+void BookView::readDepth(DepthView& out) const {
+    // Annonce du tampon dans un slot libre, puis relecture du pointeur :
+    // l'écrivain lit les annonces après avoir remplacé le courant, il ne
+    // peut donc pas reprendre un tampon encore courant après l'annonce
+    const DepthBuffer* buffer = current_.load();
+    ReaderSlot* slot = nullptr;
+    while (!slot) {
+        for (auto& reader : readers_) {
+            const DepthBuffer* expected = nullptr;
+            if (reader.hazard.compare_exchange_strong(expected, buffer)) {
+                slot = &reader;
+                break;
+            }
+        }
+        if (!slot) std::this_thread::yield();  // Tous les slots pris par d'autres lecteurs
+    }
+    for (const DepthBuffer* latest = current_.load(); latest != buffer; latest = current_.load()) {
+        buffer = latest;
+        slot->hazard.store(buffer);
+    }
+    
+    out.version = buffer->view.version;
+    out.bids.assign(buffer->view.bids.begin(), buffer->view.bids.end());
+    out.asks.assign(buffer->view.asks.begin(), buffer->view.asks.end());
+    slot->hazard.store(nullptr, std::memory_order_release);
+}
+
+std::optional<OrderView> BookView::findOrder(OrderId orderId) const {
+    if (orderId == 0) return std::nullopt;
+    
+    size_t index = slotIndex(orderId);
+    for (size_t probes = 0; probes < probeLimit_; ++probes) {
+        const OrderSlot& slot = orders_[index];
+        OrderId present = slot.orderId.load(std::memory_order_acquire);
+        if (present == 0) return std::nullopt;
+        if (present != orderId) {
+            index = (index + 1) & orderMask_;
+            continue;
+        }
+        
+        OrderView view;
+        view.orderId = orderId;
+        while (true) {
+            uint64_t before = slot.sequence.load(std::memory_order_acquire);
+            if (before & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+            OrderId current = slot.orderId.load(std::memory_order_relaxed);
+            uint32_t kind = slot.kind.load(std::memory_order_relaxed);
+            view.price = slot.price.load(std::memory_order_relaxed);
+            view.quantity = slot.quantity.load(std::memory_order_relaxed);
+            view.remainingQuantity = slot.remainingQuantity.load(std::memory_order_relaxed);
+            view.executedQuantity = slot.executedQuantity.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) == before) {
+                if (current != orderId) return std::nullopt;  // Entrée reprise entre-temps
+                view.side = static_cast<Side>(kind & 0xFF);
+                view.type = static_cast<OrderType>((kind >> 8) & 0xFF);
+                view.status = static_cast<OrderStatus>((kind >> 16) & 0xFF);
+                return view;
+            }
+        }
+    }
+    return std::nullopt;
+}
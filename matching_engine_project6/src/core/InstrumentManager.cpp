@@ -1,22 +1,152 @@
 // ===== src/core/InstrumentManager.cpp =====
 #include "core/InstrumentManager.hpp"
+#include "io/JournalWriter.hpp"
+#include "utils/ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
 
-void InstrumentManager::processOrder(Timestamp timestamp, OrderId id,
+InstrumentManager::InstrumentManager(std::pmr::memory_resource* resource)
+    : engines_(resource) {}
+
+OrderRejection InstrumentManager::processOrder(Timestamp timestamp, OrderId id,
                                    const std::string& instrument, Side side, 
                                    OrderType type, Quantity quantity, 
-                                   Price price, Action action) {
+                                   Price price, Action action, const OrderOptions& options) {
+    if (journal_) {
+        journal_->append(timestamp, id, instrument, side, type, quantity, price, action, options);
+    }
+    
     auto& engine = getOrCreateEngine(instrument);
-    engine.processOrder(timestamp, id, side, type, quantity, price, action);
+    return engine.processOrder(timestamp, id, side, type, quantity, price, action, options);
+}
+
+size_t InstrumentManager::massCancel(Timestamp timestamp, OrderId id, const std::string& instrument,
+                                     const MassCancelFilter& filter) {
+    if (journal_) {
+        journal_->appendMassCancel(timestamp, id, instrument, filter);
+    }
+    
+    auto it = engines_.find(instrument);
+    return it != engines_.end() ? it->second.massCancel(timestamp, filter) : 0;
 }
 
 MatchingEngine& InstrumentManager::getOrCreateEngine(const std::string& instrument) {
     auto it = engines_.find(instrument);
     if (it == engines_.end()) {
-        auto result = engines_.emplace(instrument, 
-            std::make_unique<MatchingEngine>(instrument));
-        return *result.first->second;
+        it = engines_.try_emplace(instrument, instrument).first;
+        if (bookViews_) {
+            it->second.enableBookView(*bookViews_);
+        }
+        {
+            std::lock_guard<std::mutex> lock(registryMutex_);
+            registry_.emplace_back(it->first, &it->second);
+        }
+        if (inAuction_) {
+            it->second.startAuction();
+        }
+        if (riskLimits_.isEnabled()) {
+            it->second.setRiskLimits(riskLimits_);
+        }
+        it->second.setEventMode(eventMode_);
+        if (capacity_.ordersPerBook > 0) {
+            it->second.reserve(capacity_.ordersPerBook);
+        }
+    }
+    return it->second;
+}
+
+void InstrumentManager::expireDayOrders() {
+    for (auto& [instrument, engine] : engines_) {
+        engine.expireDayOrders();
+    }
+}
+
+void InstrumentManager::setAllocationPolicy(const std::string& instrument, AllocationPolicy policy) {
+    getOrCreateEngine(instrument).setAllocationPolicy(policy);
+}
+
+void InstrumentManager::setPriceBand(const std::string& instrument, const PriceBand& band) {
+    getOrCreateEngine(instrument).setPriceBand(band);
+}
+
+void InstrumentManager::endHalts() {
+    for (auto& [instrument, engine] : engines_) {
+        engine.endHalt();
+    }
+}
+
+void InstrumentManager::setEventMode(EventMode mode) {
+    eventMode_ = mode;
+    for (auto& [instrument, engine] : engines_) {
+        engine.setEventMode(mode);
+    }
+}
+
+void InstrumentManager::enableBookViews(const BookViewConfig& config) {
+    bookViews_ = config;
+    for (auto& [instrument, engine] : engines_) {
+        engine.enableBookView(config);
+    }
+}
+
+const BookView* InstrumentManager::findBookView(std::string_view instrument) const {
+    std::lock_guard<std::mutex> lock(registryMutex_);
+    for (const auto& [name, engine] : registry_) {
+        if (name == instrument) return engine->getBookView();
     }
-    return *it->second;
+    return nullptr;
+}
+
+void InstrumentManager::setRiskLimits(const RiskLimits& limits) {
+    riskLimits_ = limits;
+    for (auto& [instrument, engine] : engines_) {
+        engine.setRiskLimits(limits);
+    }
+}
+
+void InstrumentManager::startAuction() {
+    inAuction_ = true;
+    for (auto& [instrument, engine] : engines_) {
+        engine.startAuction();
+    }
+}
+
+Quantity InstrumentManager::uncrossAll(Timestamp timestamp, ThreadPool* pool) {
+    inAuction_ = false;
+    
+    // Une arène (monotone ou pool non synchronisé) ne supporte pas les
+    // allocations concurrentes : seul le tas global autorise le parallélisme
+    bool parallel = pool && pool->size() > 1 &&
+                    getMemoryResource()->is_equal(*std::pmr::new_delete_resource());
+    
+    if (!parallel) {
+        Quantity volume = 0;
+        for (auto& [instrument, engine] : engines_) {
+            volume += engine.uncross(timestamp).volume;
+        }
+        return volume;
+    }
+    
+    std::atomic<Quantity> volume{0};
+    std::exception_ptr failure;
+    std::mutex failureMutex;
+    for (auto& [instrument, engine] : engines_) {
+        MatchingEngine* target = &engine;
+        pool->submit([target, timestamp, &volume, &failure, &failureMutex] {
+            try {
+                volume.fetch_add(target->uncross(timestamp).volume, std::memory_order_relaxed);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(failureMutex);
+                if (!failure) failure = std::current_exception();
+            }
+        });
+    }
+    pool->wait();
+    
+    if (failure) std::rethrow_exception(failure);
+    return volume.load();
 }
 
 std::vector<OrderEvent> InstrumentManager::getAllEvents() const {
@@ -24,12 +154,13 @@ std::vector<OrderEvent> InstrumentManager::getAllEvents() const {
     
     // Collecter tous les événements de tous les instruments
     for (const auto& [instrument, engine] : engines_) {
-        const auto& events = engine->getEvents();
+        const auto& events = engine.getEvents();
         allEvents.insert(allEvents.end(), events.begin(), events.end());
     }
     
     // Trier par timestamp pour maintenir l'ordre chronologique
-    std::sort(allEvents.begin(), allEvents.end(), 
+    // (tri stable : à timestamp égal, l'ordre d'insertion est conservé)
+    std::stable_sort(allEvents.begin(), allEvents.end(), 
               [](const OrderEvent& a, const OrderEvent& b) {
                   if (a.actionTimestamp != b.actionTimestamp) {
                       return a.actionTimestamp < b.actionTimestamp;
@@ -40,3 +171,47 @@ std::vector<OrderEvent> InstrumentManager::getAllEvents() const {
     
     return allEvents;
 }
+
+std::vector<Trade> InstrumentManager::getAllTrades() const {
+    std::vector<Trade> allTrades;
+    for (const auto& [instrument, engine] : engines_) {
+        const auto& trades = engine.getTrades();
+        allTrades.insert(allTrades.end(), trades.begin(), trades.end());
+    }
+    
+    // Tri stable comme pour les événements : ordre d'exécution conservé à timestamp égal
+    std::stable_sort(allTrades.begin(), allTrades.end(),
+                     [](const Trade& a, const Trade& b) { return a.timestamp < b.timestamp; });
+    return allTrades;
+}
+
+void InstrumentManager::reserve(const CapacityConfig& config) {
+    capacity_ = config;
+    engines_.reserve(std::max(config.instruments, config.symbols.size()));
+    
+    for (auto& [instrument, engine] : engines_) {
+        engine.reserve(config.ordersPerBook);
+    }
+    for (const auto& symbol : config.symbols) {
+        getOrCreateEngine(symbol);
+    }
+}
+
+size_t InstrumentManager::estimateArenaBytes(const CapacityConfig& config) {
+    // Estimations par élément (nœuds de hachage/map et en-têtes compris)
+    constexpr size_t kHashNodeBytes = 64;
+    constexpr size_t kMapNodeBytes = 64;
+    const size_t perOrder = sizeof(Order) + 32             // Ordre + bloc de contrôle
+                          + 2 * kHashNodeBytes             // orderIndex_ + orderHistory_
+                          + 2 * sizeof(OrderEvent)         // Événements
+                          + 2 * sizeof(Trade)
+                          + sizeof(Quantity) + sizeof(OrderId) + sizeof(OrderPtr);  // Slot SoA
+    const size_t perLevel = kMapNodeBytes + sizeof(PriceLevel);
+    const size_t perBook = sizeof(MatchingEngine) + kHashNodeBytes
+                         + config.ordersPerBook * perOrder
+                         + 2 * config.levelsPerSide * perLevel;
+    
+    size_t instruments = std::max(config.instruments, config.symbols.size());
+    // Marge x2 : croissance géométrique des vecteurs et tables de buckets
+    return 2 * instruments * perBook;
+}
@@ -1,63 +1,86 @@
 // ===== src/core/MatchingEngine.cpp =====
 #include "core/MatchingEngine.hpp"
 #include "core/OrderMatcher.hpp"
-#include "exceptions/Exceptions.hpp"
+#include <algorithm>
 
-MatchingEngine::MatchingEngine(const std::string& instrument) 
-    : orderBook_(instrument) {}
+MatchingEngine::MatchingEngine(std::string_view instrument, const allocator_type& alloc) 
+    : orderBook_(instrument, alloc), events_(alloc), orderHistory_(alloc), trades_(alloc),
+      selfTradeAdjusted_(alloc), dayOrders_(alloc), massCanceled_(alloc), tradeLog_(alloc),
+      risk_(alloc) {}
 
-void MatchingEngine::processOrder(Timestamp actionTimestamp, OrderId id,
+namespace {
+    constexpr Timestamp kNanosPerDay = 86'400'000'000'000ULL;
+}
+
+OrderRejection MatchingEngine::processOrder(Timestamp actionTimestamp, OrderId id,
                                  Side side, OrderType type, 
                                  Quantity quantity, Price price, 
-                                 Action action) {
+                                 Action action, const OrderOptions& options) {
+    
+    // MASS_CANCEL est compté par massCancel, qui peut être appelé directement
+    if (action != Action::MASS_CANCEL) metrics_.ordersByAction[static_cast<size_t>(action)].add();
+    advanceDay(actionTimestamp);
+    advanceHalt(actionTimestamp);
     
     switch (action) {
         case Action::NEW: {
-            auto order = std::make_shared<Order>(actionTimestamp, id, 
-                orderBook_.getInstrument(), side, type, quantity, price);
+            // Un ordre rejeté n'entre ni au carnet ni dans l'historique
+            OrderRejection invalid = Order::validate(id, orderBook_.getInstrument(), type, quantity, price);
+            if (invalid != OrderRejection::NONE) {
+                return reject(actionTimestamp, id, side, type, quantity, price, Action::NEW, invalid);
+            }
+            
+            // Identifiant d'un ordre encore actif (au carnet ou stop en attente)
+            auto existing = orderHistory_.find(id);
+            if (existing != orderHistory_.end() && existing->second->isActive()) {
+                return reject(actionTimestamp, id, side, type, quantity, price, Action::NEW,
+                              OrderRejection::DUPLICATE_ORDER_ID);
+            }
+            
+            // Enchère : seuls les ordres qui peuvent attendre le fixing
+            if (phase_ == TradingPhase::AUCTION &&
+                ((type == OrderType::MARKET && options.stopPrice <= 0) ||
+                 options.timeInForce == TimeInForce::IOC || options.timeInForce == TimeInForce::FOK)) {
+                return reject(actionTimestamp, id, side, type, quantity, price, Action::NEW,
+                              OrderRejection::AUCTION_PHASE);
+            }
+            
+            // Contrôles pré-trade
+            if (risk_.isEnabled() &&
+                risk_.check(orderBook_, side, type, quantity, price, options.owner) != RiskRejection::NONE) {
+                return reject(actionTimestamp, id, side, type, quantity, price, Action::NEW,
+                              OrderRejection::RISK_LIMIT);
+            }
+            
+            auto order = std::allocate_shared<Order>(
+                std::pmr::polymorphic_allocator<Order>(getMemoryResource()),
+                actionTimestamp, id, orderBook_.getInstrument(), side, type, quantity, price);
+            order->setOptions(options);
             
             orderHistory_[id] = order;
             
             // Essayer de matcher AVANT de créer l'événement
-            auto trades = OrderMatcher::matchOrder(order, orderBook_);
+            placeOrder(order);
+            trackRisk(order);
             
             // Pour les ordres MARKET, ne pas créer d'événement PENDING
             // car ils sont soit exécutés immédiatement, soit annulés
-            if (trades.empty() && order->isActive() && order->getType() == OrderType::LIMIT) {
+            // (un ordre stop en attente de déclenchement a le sien, quel que soit son type)
+            if (trades_.empty() && order->isActive() &&
+                (order->getType() == OrderType::LIMIT || order->isStop())) {
                 events_.emplace_back(actionTimestamp, id, orderBook_.getInstrument(),
-                                   side, type, quantity, price, Action::NEW,
+                                   side, type, order->getVisibleQuantity(), price, Action::NEW,
                                    OrderStatus::PENDING);
             }
             
             // Pour chaque trade, créer les événements d'exécution
-            for (const auto& trade : trades) {
-                // Récupérer les ordres impliqués
-                auto buyOrder = orderHistory_[trade.buyOrderId];
-                auto sellOrder = orderHistory_[trade.sellOrderId];
-                
-                // Event pour l'ordre de vente
-                Quantity sellDisplayQty = sellOrder->getRemainingQuantity() > 0 ? 
-                    sellOrder->getRemainingQuantity() : 0;
-                OrderStatus sellStatus = sellOrder->getRemainingQuantity() > 0 ? 
-                    OrderStatus::PARTIALLY_EXECUTED : OrderStatus::EXECUTED;
-                
-                events_.emplace_back(actionTimestamp, trade.sellOrderId, 
-                                   trade.instrument, Side::SELL, sellOrder->getType(),
-                                   sellDisplayQty, sellOrder->getPrice(), Action::NEW,
-                                   sellStatus, trade.quantity, trade.price, 
-                                   trade.buyOrderId);
-                
-                // Event pour l'ordre d'achat
-                Quantity buyDisplayQty = buyOrder->getRemainingQuantity() > 0 ? 
-                    buyOrder->getRemainingQuantity() : 0;
-                OrderStatus buyStatus = buyOrder->getRemainingQuantity() > 0 ? 
-                    OrderStatus::PARTIALLY_EXECUTED : OrderStatus::EXECUTED;
-                
-                events_.emplace_back(actionTimestamp, trade.buyOrderId, 
-                                   trade.instrument, Side::BUY, buyOrder->getType(),
-                                   buyDisplayQty, buyOrder->getPrice(), Action::NEW,
-                                   buyStatus, trade.quantity, trade.price, 
-                                   trade.sellOrderId);
+            emitTradeEvents(actionTimestamp);
+            
+            emitTriggeredEvents(actionTimestamp);
+            emitCancelEvents(actionTimestamp, order, Action::NEW);
+            
+            if (order->getTimeInForce() == TimeInForce::DAY && order->isActive()) {
+                dayOrders_.push_back(order);
             }
             
             // Gestion spéciale pour les ordres MARKET avec reliquat annulé
@@ -83,84 +106,91 @@ void MatchingEngine::processOrder(Timestamp actionTimestamp, OrderId id,
         case Action::MODIFY: {
             auto existingOrder = orderBook_.findOrder(id);
             if (!existingOrder) {
-                throw OrderNotFoundException(id);
+                return reject(actionTimestamp, id, side, type, quantity, price, Action::MODIFY,
+                              OrderRejection::UNKNOWN_ORDER);
             }
             
-            // Les ordres MARKET ne peuvent pas être modifiés
-            if (existingOrder->getType() == OrderType::MARKET) {
-                throw InvalidOrderException(id, "Cannot modify MARKET orders");
+            // Les ordres MARKET ne peuvent pas être modifiés ; la nouvelle
+            // quantité doit laisser un reste à exécuter
+            OrderRejection invalid = existingOrder->getType() == OrderType::MARKET
+                ? OrderRejection::NOT_MODIFIABLE
+                : quantity <= existingOrder->getExecutedQuantity() ? OrderRejection::INVALID_QUANTITY
+                : price <= 0 ? OrderRejection::INVALID_PRICE
+                : OrderRejection::NONE;
+            if (invalid != OrderRejection::NONE) {
+                return reject(actionTimestamp, id, existingOrder->getSide(), existingOrder->getType(),
+                              quantity, price, Action::MODIFY, invalid);
             }
             
-            // Retirer l'ordre du carnet
+            // Baisse de quantité au même prix : modification sur place, l'ordre
+            // garde sa priorité temps et ne peut rien exécuter de nouveau
+            if (price == existingOrder->getPrice() && quantity < existingOrder->getQuantity() &&
+                quantity > existingOrder->getExecutedQuantity()) {
+                orderBook_.reduceOrder(id, quantity);
+                trackRisk(existingOrder);
+                events_.emplace_back(actionTimestamp, id, orderBook_.getInstrument(),
+                                   existingOrder->getSide(), existingOrder->getType(),
+                                   existingOrder->isIceberg() ? existingOrder->getVisibleQuantity() : quantity,
+                                   price, Action::MODIFY, OrderStatus::PENDING);
+                break;
+            }
+            
+            // Sinon (prix changé ou hausse de quantité) : contrôles pré-trade sur
+            // le nouvel état, un rejet laisse l'ordre inchangé
+            if (risk_.isEnabled() &&
+                risk_.check(orderBook_, existingOrder->getSide(), existingOrder->getType(), quantity,
+                            price, existingOrder->getOwner(), existingOrder.get()) != RiskRejection::NONE) {
+                return reject(actionTimestamp, id, existingOrder->getSide(), existingOrder->getType(),
+                              quantity, price, Action::MODIFY, OrderRejection::RISK_LIMIT);
+            }
+            
+            // Perte de priorité : retrait du carnet puis nouveau passage au matching
             orderBook_.removeOrder(id);
             
             // Mettre à jour l'ordre
             existingOrder->updateQuantity(quantity);
             existingOrder->updatePrice(price);
             
-            // Essayer de matcher
-            auto trades = OrderMatcher::matchOrder(existingOrder, orderBook_);
+            // Essayer de matcher (en enchère : retour au carnet sans matching)
+            placeOrder(existingOrder);
+            trackRisk(existingOrder);
             
             // Si l'ordre modifié n'a pas été exécuté, créer un événement PENDING
-            if (trades.empty() && existingOrder->isActive()) {
+            if (trades_.empty() && existingOrder->isActive()) {
                 events_.emplace_back(actionTimestamp, id, orderBook_.getInstrument(),
                                    existingOrder->getSide(), existingOrder->getType(),
-                                   quantity, price, Action::MODIFY,
-                                   OrderStatus::PENDING);
+                                   existingOrder->isIceberg() ? existingOrder->getVisibleQuantity() : quantity,
+                                   price, Action::MODIFY, OrderStatus::PENDING);
             }
             
             // Générer les événements d'exécution
-            for (const auto& trade : trades) {
-                auto buyOrder = orderHistory_[trade.buyOrderId];
-                auto sellOrder = orderHistory_[trade.sellOrderId];
-                
-                // Event pour l'ordre de vente
-                Quantity sellDisplayQty = sellOrder->getRemainingQuantity() > 0 ? 
-                    sellOrder->getRemainingQuantity() : 0;
-                OrderStatus sellStatus = sellOrder->getRemainingQuantity() > 0 ? 
-                    OrderStatus::PARTIALLY_EXECUTED : OrderStatus::EXECUTED;
-                
-                Action sellAction = (trade.sellOrderId == id) ? Action::MODIFY : Action::NEW;
-                
-                events_.emplace_back(actionTimestamp, trade.sellOrderId, 
-                                   trade.instrument, Side::SELL, sellOrder->getType(),
-                                   sellDisplayQty, sellOrder->getPrice(), sellAction,
-                                   sellStatus, trade.quantity, trade.price, 
-                                   trade.buyOrderId);
-                
-                // Event pour l'ordre d'achat
-                Quantity buyDisplayQty = buyOrder->getRemainingQuantity() > 0 ? 
-                    buyOrder->getRemainingQuantity() : 0;
-                OrderStatus buyStatus = buyOrder->getRemainingQuantity() > 0 ? 
-                    OrderStatus::PARTIALLY_EXECUTED : OrderStatus::EXECUTED;
-                
-                Action buyAction = (trade.buyOrderId == id) ? Action::MODIFY : Action::NEW;
-                
-                events_.emplace_back(actionTimestamp, trade.buyOrderId, 
-                                   trade.instrument, Side::BUY, buyOrder->getType(),
-                                   buyDisplayQty, buyOrder->getPrice(), buyAction,
-                                   buyStatus, trade.quantity, trade.price, 
-                                   trade.sellOrderId);
-            }
+            emitTradeEvents(actionTimestamp, id);
+            
+            emitTriggeredEvents(actionTimestamp);
+            emitCancelEvents(actionTimestamp, existingOrder, Action::MODIFY);
             break;
         }
         
         case Action::CANCEL: {
             auto order = orderBook_.findOrder(id);
             if (!order) {
-                // Peut-être déjà exécuté, vérifier dans l'historique
+                // Peut-être déjà exécuté ou annulé, vérifier dans l'historique
                 auto it = orderHistory_.find(id);
-                if (it != orderHistory_.end()) {
-                    order = it->second;
-                } else {
-                    throw OrderNotFoundException(id);
+                if (it == orderHistory_.end()) {
+                    return reject(actionTimestamp, id, side, type, quantity, price, Action::CANCEL,
+                                  OrderRejection::UNKNOWN_ORDER);
                 }
+                order = it->second;
             }
             
-            if (order->isActive()) {
-                order->cancel();
-                orderBook_.removeOrder(id);
+            // CANCEL tardif : l'ordre est déjà terminé, rien à annuler
+            if (!order->isActive()) {
+                return reject(actionTimestamp, id, order->getSide(), order->getType(), quantity, price,
+                              Action::CANCEL, OrderRejection::ORDER_CLOSED);
             }
+            order->cancel();
+            orderBook_.removeOrder(id);
+            trackRisk(order);
             
             // Ajouter l'événement d'annulation
             events_.emplace_back(actionTimestamp, id, orderBook_.getInstrument(),
@@ -169,10 +199,310 @@ void MatchingEngine::processOrder(Timestamp actionTimestamp, OrderId id,
                                OrderStatus::CANCELED);
             break;
         }
+        
+        case Action::MASS_CANCEL: {
+            // Sous cette forme, le périmètre est limité au côté indiqué
+            MassCancelFilter filter;
+            filter.allSides = false;
+            filter.side = side;
+            filter.owner = options.owner;
+            filter.priceBound = price;
+            massCancel(actionTimestamp, filter);
+            break;
+        }
+    }
+    
+    checkBandBreach(actionTimestamp);
+    publishState();
+    return OrderRejection::NONE;
+}
+
+OrderRejection MatchingEngine::reject(Timestamp actionTimestamp, OrderId id, Side side,
+                                      OrderType type, Quantity quantity, Price price,
+                                      Action action, OrderRejection reason) {
+    rejectCounts_[static_cast<size_t>(reason)]++;
+    metrics_.rejects.add();
+    events_.emplace_back(actionTimestamp, id, orderBook_.getInstrument(),
+                       side, type, quantity, price, action, OrderStatus::REJECTED);
+    publishState();
+    return reason;
+}
+
+void MatchingEngine::placeOrder(const OrderPtr& order) {
+    trades_.clear();
+    selfTradeAdjusted_.clear();
+    
+    if (phase_ == TradingPhase::AUCTION) {
+        orderBook_.getStops().clearTriggered();
+        if (order->isIceberg()) order->replenish();
+        orderBook_.addOrder(order);
+    } else {
+        OrderMatcher::matchOrder(order, orderBook_, trades_, &selfTradeAdjusted_);
+    }
+}
+
+void MatchingEngine::emitTradeEvents(Timestamp actionTimestamp, OrderId modifiedId) {
+    Quantity aggressorQty = 0;  // Quantité du résumé de l'agresseur en cours (AGGREGATED)
+    size_t aggressorFills = 0;
+    metrics_.fills.add(trades_.size());
+    
+    for (size_t i = 0; i < trades_.size(); ++i) {
+        const Trade& trade = trades_[i];
+        
+        // Récupérer les ordres impliqués
+        auto buyOrder = orderHistory_[trade.buyOrderId];
+        auto sellOrder = orderHistory_[trade.sellOrderId];
+        
+        // Compteurs de risque mis à jour à chaque exécution
+        if (risk_.isEnabled()) {
+            risk_.onFill(*buyOrder, *sellOrder, trade.quantity);
+            risk_.reconcile(*buyOrder);
+            risk_.reconcile(*sellOrder);
+        }
+        
+        if (eventMode_ == EventMode::TRADES) {
+            tradeLog_.push_back(trade);
+            tradeLog_.back().timestamp = actionTimestamp;
+            continue;
+        }
+        
+        if (eventMode_ == EventMode::FULL || trade.aggressorId == 0) {
+            emitFillEvent(actionTimestamp, sellOrder, trade.quantity, trade.price,
+                          trade.buyOrderId, modifiedId);
+            emitFillEvent(actionTimestamp, buyOrder, trade.quantity, trade.price,
+                          trade.sellOrderId, modifiedId);
+            continue;
+        }
+        
+        // AGGREGATED : le fill passif a son événement, l'agresseur un seul
+        // résumé à la fin de chaque suite de fills au même prix
+        const bool aggressorBuys = trade.aggressorId == trade.buyOrderId;
+        const OrderId passiveId = aggressorBuys ? trade.sellOrderId : trade.buyOrderId;
+        emitFillEvent(actionTimestamp, aggressorBuys ? sellOrder : buyOrder, trade.quantity,
+                      trade.price, trade.aggressorId, modifiedId);
+        aggressorQty += trade.quantity;
+        aggressorFills++;
+        
+        const bool runEnds = i + 1 == trades_.size() ||
+                             trades_[i + 1].aggressorId != trade.aggressorId ||
+                             trades_[i + 1].price != trade.price;
+        if (runEnds) {
+            emitFillEvent(actionTimestamp, aggressorBuys ? buyOrder : sellOrder, aggressorQty,
+                          trade.price, aggressorFills == 1 ? passiveId : 0, modifiedId);
+            aggressorQty = 0;
+            aggressorFills = 0;
+        }
+    }
+}
+
+void MatchingEngine::emitFillEvent(Timestamp actionTimestamp, const OrderPtr& order,
+                                   Quantity quantity, Price price, OrderId counterpartyId,
+                                   OrderId modifiedId) {
+    OrderStatus status = order->getRemainingQuantity() > 0 ? 
+        OrderStatus::PARTIALLY_EXECUTED : OrderStatus::EXECUTED;
+    Action action = (order->getOrderId() == modifiedId) ? Action::MODIFY : Action::NEW;
+    
+    events_.emplace_back(actionTimestamp, order->getOrderId(), 
+                       orderBook_.getInstrument(), order->getSide(), order->getType(),
+                       order->getVisibleQuantity(), order->getPrice(), action,
+                       status, quantity, price, counterpartyId);
+}
+
+AuctionResult MatchingEngine::uncross(Timestamp actionTimestamp) {
+    phase_ = TradingPhase::CONTINUOUS;
+    haltEnd_ = 0;
+    
+    AuctionResult result = OrderMatcher::computeUncross(orderBook_, orderBook_.getLastTradePrice());
+    trades_.clear();
+    selfTradeAdjusted_.clear();
+    OrderMatcher::uncross(orderBook_, result, trades_, &selfTradeAdjusted_);
+    
+    emitTradeEvents(actionTimestamp);
+    emitTriggeredEvents(actionTimestamp);
+    emitCancelEvents(actionTimestamp, nullptr, Action::NEW);
+    // La cascade des stops déclenchés au fixing peut atteindre la bande
+    checkBandBreach(actionTimestamp);
+    publishState();
+    return result;
+}
+
+void MatchingEngine::emitCancelEvents(Timestamp actionTimestamp, const OrderPtr& order,
+                                      Action action) {
+    // Ordres au repos retirés (quantité 0) ou réduits par l'ordre entrant
+    for (const auto& adjusted : selfTradeAdjusted_) {
+        trackRisk(adjusted);
+        bool canceled = !adjusted->isActive();
+        events_.emplace_back(actionTimestamp, adjusted->getOrderId(), orderBook_.getInstrument(),
+                           adjusted->getSide(), adjusted->getType(),
+                           canceled ? 0 : adjusted->getVisibleQuantity(),
+                           canceled ? 0 : adjusted->getPrice(), action,
+                           adjusted->getStatus());
+    }
+    
+    // Ordre LIMIT entrant annulé : auto-exécution, reliquat IOC, FOK non exécutable
+    // (les ordres MARKET ont leur propre événement)
+    if (order && order->getType() == OrderType::LIMIT && order->getStatus() == OrderStatus::CANCELED) {
+        events_.emplace_back(actionTimestamp, order->getOrderId(), orderBook_.getInstrument(),
+                           order->getSide(), order->getType(), 0, 0, action,
+                           OrderStatus::CANCELED);
+    }
+}
+
+void MatchingEngine::emitTriggeredEvents(Timestamp actionTimestamp) {
+    // Stops déclenchés : ceux qui ont tradé ont déjà leurs événements
+    // d'exécution, sauf l'annulation de leur reliquat (MARKET, IOC)
+    for (const auto& triggered : orderBook_.getStops().getTriggered()) {
+        trackRisk(triggered);
+        if (triggered->getExecutedQuantity() > 0 &&
+            triggered->getStatus() != OrderStatus::CANCELED) continue;
+        bool active = triggered->isActive();
+        events_.emplace_back(actionTimestamp, triggered->getOrderId(), orderBook_.getInstrument(),
+                           triggered->getSide(), triggered->getType(),
+                           active ? triggered->getVisibleQuantity() : 0,
+                           active ? triggered->getPrice() : 0, Action::NEW,
+                           triggered->getStatus());
+    }
+}
+
+void MatchingEngine::advanceDay(Timestamp actionTimestamp) {
+    // Changement de jour : les ordres DAY de la veille expirent
+    if (actionTimestamp >= dayEnd_) {
+        expireDayOrders();
+        dayEnd_ = (actionTimestamp / kNanosPerDay + 1) * kNanosPerDay;
+    }
+}
+
+void MatchingEngine::checkBandBreach(Timestamp actionTimestamp) {
+    if (!orderBook_.takeBandBreach()) return;
+    const Timestamp duration = orderBook_.getPriceBand().haltDuration;
+    if (duration > 0 && phase_ == TradingPhase::CONTINUOUS) {
+        phase_ = TradingPhase::AUCTION;
+        haltEnd_ = actionTimestamp + duration;
     }
 }
 
+size_t MatchingEngine::massCancel(Timestamp actionTimestamp, const MassCancelFilter& filter) {
+    metrics_.ordersByAction[static_cast<size_t>(Action::MASS_CANCEL)].add();
+    advanceDay(actionTimestamp);
+    advanceHalt(actionTimestamp);
+    
+    massCanceled_.clear();
+    orderBook_.massCancel(filter, massCanceled_);
+    
+    // Événements CANCELED émis en un lot, dans l'ordre des niveaux
+    events_.reserve(events_.size() + massCanceled_.size());
+    for (const auto& order : massCanceled_) {
+        trackRisk(order);
+        events_.emplace_back(actionTimestamp, order->getOrderId(), orderBook_.getInstrument(),
+                           order->getSide(), order->getType(), 0, 0, Action::CANCEL,
+                           OrderStatus::CANCELED);
+    }
+    
+    size_t count = massCanceled_.size();
+    massCanceled_.clear();  // Ne pas retenir les ordres annulés
+    publishState();
+    return count;
+}
+
+void MatchingEngine::expireDayOrders() {
+    for (const auto& order : dayOrders_) {
+        if (!order->isActive()) continue;  // Déjà exécuté ou annulé
+        
+        order->cancel();
+        orderBook_.removeOrder(order->getOrderId());
+        trackRisk(order);
+        events_.emplace_back(dayEnd_, order->getOrderId(), orderBook_.getInstrument(),
+                           order->getSide(), order->getType(), 0, 0, Action::CANCEL,
+                           OrderStatus::CANCELED);
+    }
+    dayOrders_.clear();
+    publishState();
+}
+
 OrderPtr MatchingEngine::getOrder(OrderId id) const {
     auto it = orderHistory_.find(id);
     return (it != orderHistory_.end()) ? it->second : nullptr;
-}
\ No newline at end of file
+}
+
+void MatchingEngine::discardEvents() {
+    eventsDiscarded_ += events_.size();
+    events_.clear();
+    tradeLog_.clear();
+    viewEventIndex_ = 0;
+    viewTradeIndex_ = 0;
+}
+
+void MatchingEngine::reserve(size_t orders) {
+    orderBook_.reserve(orders);
+    orderHistory_.reserve(orders);
+    events_.reserve(orders * 2);  // ~1 événement par ordre + 2 par fill
+    trades_.reserve(64);
+}
+
+void MatchingEngine::restoreOrder(Timestamp timestamp, OrderId id, Side side, OrderType type,
+                                  Quantity quantity, Price price, Quantity remainingQuantity,
+                                  Quantity executedQuantity, Price executionPrice,
+                                  OrderId counterpartyId, OrderStatus status,
+                                  const OrderOptions& options, Quantity visibleQuantity) {
+    auto order = std::allocate_shared<Order>(
+        std::pmr::polymorphic_allocator<Order>(getMemoryResource()),
+        timestamp, id, orderBook_.getInstrument(), side, type, quantity, price);
+    
+    order->setOptions(options);
+    order->restoreState(remainingQuantity, executedQuantity, executionPrice,
+                        counterpartyId, status, visibleQuantity);
+    
+    // Jour courant : celui du dernier ordre restauré
+    dayEnd_ = std::max(dayEnd_, (timestamp / kNanosPerDay + 1) * kNanosPerDay);
+    
+    orderHistory_[id] = order;
+    if (order->isActive()) {
+        if (options.timeInForce == TimeInForce::DAY) {
+            dayOrders_.push_back(order);
+        }
+        trackRisk(order);
+        orderBook_.addOrder(order);
+    }
+    if (view_) {
+        view_->publishOrder(*order);
+        view_->publishBook(orderBook_);
+    }
+}
+
+void MatchingEngine::enableBookView(const BookViewConfig& config) {
+    view_ = std::make_unique<BookView>(config);
+    for (const auto& [id, order] : orderHistory_) {
+        view_->publishOrder(*order);
+    }
+    viewEventIndex_ = events_.size();
+    viewTradeIndex_ = tradeLog_.size();
+    view_->publishBook(orderBook_);
+}
+
+void MatchingEngine::publishView() {
+    auto publish = [this](OrderId id) {
+        auto it = orderHistory_.find(id);
+        if (it != orderHistory_.end()) view_->publishOrder(*it->second);
+    };
+    // Les événements couvrent les modes FULL et AGGREGATED, les trades le mode TRADES
+    for (; viewEventIndex_ < events_.size(); ++viewEventIndex_) {
+        publish(events_[viewEventIndex_].orderId);
+    }
+    for (; viewTradeIndex_ < tradeLog_.size(); ++viewTradeIndex_) {
+        publish(tradeLog_[viewTradeIndex_].buyOrderId);
+        publish(tradeLog_[viewTradeIndex_].sellOrderId);
+    }
+    view_->publishBook(orderBook_);
+}
+
+void MatchingEngine::setRiskLimits(const RiskLimits& limits) {
+    risk_.setLimits(limits);
+    
+    // Exposition ouverte recalculée depuis les ordres actifs (les positions
+    // exécutées sont conservées)
+    risk_.clearOpenExposure();
+    for (const auto& [id, order] : orderHistory_) {
+        order->setRiskExposure(0, 0);
+        trackRisk(order);
+    }
+}
@@ -1,39 +1,53 @@
 // ===== src/core/Order.cpp =====
 #include "core/Order.hpp"
 #include "exceptions/Exceptions.hpp"
+#include <algorithm>
 
-Order::Order(Timestamp ts, OrderId id, std::string instrument, 
-             Side side, OrderType type, Quantity qty, Price price)
-    : timestamp_(ts), orderId_(id), instrument_(std::move(instrument)),
+Order::Order(Timestamp ts, OrderId id, std::string_view instrument, 
+             Side side, OrderType type, Quantity qty, Price price,
+             const allocator_type& alloc)
+    : timestamp_(ts), orderId_(id), instrument_(instrument, alloc),
       side_(side), type_(type), quantity_(qty), remainingQuantity_(qty),
       executedQuantity_(0), price_(price), executionPrice_(0.0),
-      status_(OrderStatus::PENDING), counterpartyId_(0) {
+      status_(OrderStatus::PENDING), counterpartyId_(0), visibleQuantity_(qty) {
     
-    if (id == 0) {
-        throw InvalidOrderException(id, "Order ID cannot be zero");
-    }
-    if (instrument_.empty()) {
-        throw InvalidOrderException(id, "Instrument cannot be empty");
-    }
-    if (qty == 0) {
-        throw InvalidOrderException(id, "Quantity must be positive");
+    switch (validate(id, instrument, type, qty, price)) {
+        case OrderRejection::INVALID_ORDER_ID:
+            throw InvalidOrderException(id, "Order ID cannot be zero");
+        case OrderRejection::EMPTY_INSTRUMENT:
+            throw InvalidOrderException(id, "Instrument cannot be empty");
+        case OrderRejection::INVALID_QUANTITY:
+            throw InvalidOrderException(id, "Quantity must be positive");
+        case OrderRejection::INVALID_PRICE:
+            // Pour les ordres LIMIT, le prix doit être positif
+            throw InvalidOrderException(id, "Limit order must have positive price");
+        default:
+            break;
     }
     
     // IMPORTANT: Forcer le prix à 0 pour les ordres MARKET
     if (type == OrderType::MARKET) {
         price_ = 0.0;
-    } else if (price <= 0.0) {
-        // Pour les ordres LIMIT, le prix doit être positif
-        throw InvalidOrderException(id, "Limit order must have positive price");
     }
 }
 
+OrderRejection Order::validate(OrderId id, std::string_view instrument, OrderType type,
+                               Quantity qty, Price price) {
+    if (id == 0) return OrderRejection::INVALID_ORDER_ID;
+    if (instrument.empty()) return OrderRejection::EMPTY_INSTRUMENT;
+    if (qty == 0) return OrderRejection::INVALID_QUANTITY;
+    if (type == OrderType::LIMIT && price <= 0.0) return OrderRejection::INVALID_PRICE;
+    return OrderRejection::NONE;
+}
+
 void Order::updateQuantity(Quantity newQty) {
     if (newQty == 0) {
         throw InvalidOrderException(orderId_, "Cannot update to zero quantity");
     }
     quantity_ = newQty;
     remainingQuantity_ = newQty - executedQuantity_;
+    // Iceberg : la tranche visible ne peut dépasser le nouveau reste
+    visibleQuantity_ = std::min(visibleQuantity_, remainingQuantity_);
 }
 
 void Order::updatePrice(Price newPrice) {
@@ -49,6 +63,16 @@ void Order::updatePrice(Price newPrice) {
     price_ = newPrice;
 }
 
+void Order::setOptions(const OrderOptions& options) {
+    options_ = options;
+    visibleQuantity_ = std::min(options_.displayQuantity, remainingQuantity_);
+}
+
+Quantity Order::replenish() {
+    visibleQuantity_ = std::min(options_.displayQuantity, remainingQuantity_);
+    return visibleQuantity_;
+}
+
 void Order::execute(Quantity executedQty, Price execPrice, OrderId counterparty) {
     if (executedQty > remainingQuantity_) {
         throw InvalidOrderException(orderId_, "Execution quantity exceeds remaining");
@@ -56,6 +80,7 @@ void Order::execute(Quantity executedQty, Price execPrice, OrderId counterparty)
     
     executedQuantity_ += executedQty;
     remainingQuantity_ -= executedQty;
+    visibleQuantity_ -= std::min(executedQty, visibleQuantity_);
     executionPrice_ = execPrice;
     counterpartyId_ = counterparty;
     
@@ -71,4 +96,28 @@ void Order::cancel() {
         throw InvalidOrderException(orderId_, "Cannot cancel executed order");
     }
     status_ = OrderStatus::CANCELED;
-}
\ No newline at end of file
+}
+
+void Order::decrement(Quantity qty) {
+    if (qty > remainingQuantity_) {
+        throw InvalidOrderException(orderId_, "Decrement exceeds remaining quantity");
+    }
+    quantity_ -= qty;
+    remainingQuantity_ -= qty;
+    visibleQuantity_ -= std::min(qty, visibleQuantity_);
+    
+    // La quantité de l'ordre est réduite : s'il a déjà été exécuté, il l'est entièrement
+    if (remainingQuantity_ == 0) {
+        status_ = executedQuantity_ > 0 ? OrderStatus::EXECUTED : OrderStatus::CANCELED;
+    }
+}
+
+void Order::restoreState(Quantity remaining, Quantity executed, Price execPrice,
+                         OrderId counterparty, OrderStatus status, Quantity visible) {
+    remainingQuantity_ = remaining;
+    visibleQuantity_ = visible > 0 ? visible : std::min(options_.displayQuantity, remaining);
+    executedQuantity_ = executed;
+    executionPrice_ = execPrice;
+    counterpartyId_ = counterparty;
+    status_ = status;
+}
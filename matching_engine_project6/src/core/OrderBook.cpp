@@ -3,10 +3,16 @@
 #include "core/OrderBook.hpp"
 #include "exceptions/Exceptions.hpp"
 
-OrderBook::OrderBook(const std::string& instrument) 
-    : instrument_(instrument) {}
+OrderBook::OrderBook(std::string_view instrument, const allocator_type& alloc) 
+    : instrument_(instrument, alloc), bids_(alloc), asks_(alloc), orderIndex_(alloc),
+      stops_(alloc), lastTradePrice_(0) {}
 
 void OrderBook::addOrder(OrderPtr order) {
+    if (order->isStop()) {
+        stops_.addOrder(std::move(order));
+        return;
+    }
+    
     Price price = order->getPrice();
     orderIndex_[order->getOrderId()] = {order, price};
     
@@ -20,6 +26,7 @@ void OrderBook::addOrder(OrderPtr order) {
 void OrderBook::removeOrder(OrderId orderId) {
     auto it = orderIndex_.find(orderId);
     if (it == orderIndex_.end()) {
+        if (stops_.removeOrder(orderId)) return;
         throw OrderNotFoundException(orderId);
     }
     
@@ -34,7 +41,80 @@ void OrderBook::removeOrder(OrderId orderId) {
     orderIndex_.erase(it);
 }
 
+void OrderBook::reduceOrder(OrderId orderId, Quantity newQty) {
+    auto it = orderIndex_.find(orderId);
+    if (it == orderIndex_.end()) {
+        // Stop non déclenché : rien n'est agrégé, sa place dans le seau est conservée
+        OrderPtr stop = stops_.findOrder(orderId);
+        if (!stop) throw OrderNotFoundException(orderId);
+        stop->updateQuantity(newQty);
+        return;
+    }
+    
+    auto& [order, price] = it->second;
+    order->updateQuantity(newQty);
+    
+    if (order->getSide() == Side::BUY) {
+        bids_.reduceOrder(orderId, price);
+    } else {
+        asks_.reduceOrder(orderId, price);
+    }
+}
+
+void OrderBook::massCancel(const MassCancelFilter& filter, std::pmr::vector<OrderPtr>& canceled) {
+    if (filter.allSides || filter.side == Side::BUY) cancelLevels(bids_, filter, canceled);
+    if (filter.allSides || filter.side == Side::SELL) cancelLevels(asks_, filter, canceled);
+    
+    // Un stop au marché n'a pas de prix : il n'est visé que sans borne
+    stops_.removeIf([&filter](const Order& order) {
+        if (!filter.allSides && order.getSide() != filter.side) return false;
+        if (filter.owner != 0 && order.getOwner() != filter.owner) return false;
+        if (filter.priceBound <= 0) return true;
+        if (order.getType() != OrderType::LIMIT) return false;
+        return order.getSide() == Side::BUY ? order.getPrice() >= filter.priceBound
+                                            : order.getPrice() <= filter.priceBound;
+    }, canceled);
+    
+    for (const auto& order : canceled) {
+        if (order->isActive()) order->cancel();
+    }
+}
+
+template<typename BookSideType>
+void OrderBook::cancelLevels(BookSideType& side, const MassCancelFilter& filter,
+                             std::pmr::vector<OrderPtr>& canceled) {
+    typename BookSideType::Compare better;
+    
+    // Niveaux du meilleur prix vers la borne : un préfixe de la map
+    for (auto it = side.begin(); it != side.end();) {
+        PriceLevel& level = it->second;
+        if (filter.priceBound > 0 && better(filter.priceBound, level.getPrice())) break;
+        
+        if (filter.owner == 0) {
+            for (size_t slot = level.beginSlot(); slot < level.endSlot(); ++slot) {
+                if (const OrderPtr& order = level.orderAt(slot)) {
+                    orderIndex_.erase(order->getOrderId());
+                    canceled.push_back(order);
+                }
+            }
+            it = side.eraseLevel(it);
+            continue;
+        }
+        
+        bool swept = false;
+        for (size_t slot = level.beginSlot(); slot < level.endSlot(); ++slot) {
+            if (level.ownerAt(slot) != filter.owner) continue;
+            orderIndex_.erase(level.orderAt(slot)->getOrderId());
+            canceled.push_back(level.orderAt(slot));
+            level.clearSlot(slot);
+            swept = true;
+        }
+        if (swept) level.settle();
+        it = level.isEmpty() ? side.eraseLevel(it) : std::next(it);
+    }
+}
+
 OrderPtr OrderBook::findOrder(OrderId orderId) const {
     auto it = orderIndex_.find(orderId);
-    return (it != orderIndex_.end()) ? it->second.first : nullptr;
+    return (it != orderIndex_.end()) ? it->second.first : stops_.findOrder(orderId);
 }
\ No newline at end of file
@@ -1,120 +1,601 @@
 // ===== src/core/OrderMatcher.cpp =====
 #include "core/OrderMatcher.hpp"
 #include "utils/TimeUtils.hpp"
+#include <cmath>
+#include <iterator>
 
-std::vector<Trade> OrderMatcher::matchOrder(OrderPtr incomingOrder, OrderBook& book) {
-    if (incomingOrder->getType() == OrderType::MARKET) {
-        return matchMarketOrder(incomingOrder, book);
+std::pmr::vector<Trade> OrderMatcher::matchOrder(OrderPtr incomingOrder, OrderBook& book) {
+    std::pmr::vector<Trade> trades;
+    matchOrder(std::move(incomingOrder), book, trades);
+    return trades;
+}
+
+void OrderMatcher::matchOrder(OrderPtr incomingOrder, OrderBook& book,
+                              std::pmr::vector<Trade>& trades,
+                              std::pmr::vector<OrderPtr>* selfTradeAdjusted) {
+    StopBook& stops = book.getStops();
+    stops.clearTriggered();
+    
+    // Stop pas encore atteint : l'ordre attend dans le carnet de déclenchement
+    if (incomingOrder->isStop()) {
+        if (!StopBook::isTriggeredBy(*incomingOrder, book.getLastTradePrice())) {
+            book.addOrder(std::move(incomingOrder));
+            return;
+        }
+        incomingOrder->trigger();
+    }
+    
+    dispatch(std::move(incomingOrder), book, trades, selfTradeAdjusted);
+    
+    // Cascade : les stops déclenchés sont matchés dans l'ordre de déclenchement,
+    // et peuvent eux-mêmes en déclencher d'autres
+    while (OrderPtr triggered = stops.popTriggered()) {
+        dispatch(std::move(triggered), book, trades, selfTradeAdjusted);
+    }
+}
+
+void OrderMatcher::dispatch(OrderPtr order, OrderBook& book,
+                            std::pmr::vector<Trade>& trades,
+                            std::pmr::vector<OrderPtr>* selfTradeAdjusted) {
+    if (order->getType() == OrderType::MARKET) {
+        matchMarketOrder(std::move(order), book, trades, selfTradeAdjusted);
     } else {
-        return matchLimitOrder(incomingOrder, book);
+        matchLimitOrder(std::move(order), book, trades, selfTradeAdjusted);
     }
 }
 
-std::vector<Trade> OrderMatcher::matchLimitOrder(OrderPtr order, OrderBook& book) {
-    std::vector<Trade> trades;
-    
+void OrderMatcher::matchIncoming(OrderPtr order, OrderBook& book,
+                                 std::pmr::vector<Trade>& trades,
+                                 std::pmr::vector<OrderPtr>* selfTradeAdjusted) {
+    switch (book.getAllocationPolicy()) {
+        case AllocationPolicy::FIFO:
+            matchWithPolicy<FifoAllocation>(std::move(order), book, trades, selfTradeAdjusted);
+            break;
+        case AllocationPolicy::PRO_RATA:
+            matchWithPolicy<ProRataAllocation>(std::move(order), book, trades, selfTradeAdjusted);
+            break;
+        case AllocationPolicy::TOP_PRO_RATA:
+            matchWithPolicy<TopOrderProRataAllocation>(std::move(order), book, trades, selfTradeAdjusted);
+            break;
+    }
+}
+
+template<typename Policy>
+void OrderMatcher::matchWithPolicy(OrderPtr order, OrderBook& book,
+                                   std::pmr::vector<Trade>& trades,
+                                   std::pmr::vector<OrderPtr>* selfTradeAdjusted) {
     if (order->getSide() == Side::BUY) {
-        auto& asks = book.getAsks();
-        trades = matchAgainstSide(order, asks, book);
+        matchAgainstSide<Policy>(std::move(order), book.getAsks(), book, trades, selfTradeAdjusted);
     } else {
-        auto& bids = book.getBids();
-        trades = matchAgainstSide(order, bids, book);
+        matchAgainstSide<Policy>(std::move(order), book.getBids(), book, trades, selfTradeAdjusted);
     }
+}
+
+void OrderMatcher::matchLimitOrder(OrderPtr order, OrderBook& book,
+                                   std::pmr::vector<Trade>& trades,
+                                   std::pmr::vector<OrderPtr>* selfTradeAdjusted) {
+    const TimeInForce tif = order->getTimeInForce();
     
-    if (order->isActive()) {
-        book.addOrder(order);
+    if (tif == TimeInForce::FOK) {
+        const SweepLimit limit = book.getSweepLimit(order->getSide());
+        bool fillable = order->getSide() == Side::BUY
+            ? canFillCompletely(*order, book.getAsks(), limit)
+            : canFillCompletely(*order, book.getBids(), limit);
+        if (!fillable) {
+            order->cancel();
+            return;
+        }
     }
     
-    return trades;
+    matchIncoming(order, book, trades, selfTradeAdjusted);
+    
+    if (order->isActive()) {
+        // IOC (et FOK par sécurité) : le reliquat ne reste jamais au carnet
+        if (tif == TimeInForce::IOC || tif == TimeInForce::FOK) {
+            order->cancel();
+        } else {
+            // Iceberg : seule la première tranche est affichée au carnet
+            if (order->isIceberg()) order->replenish();
+            book.addOrder(order);
+        }
+    }
 }
 
-std::vector<Trade> OrderMatcher::matchMarketOrder(OrderPtr order, OrderBook& book) {
-    std::vector<Trade> trades;
-    
-    if (order->getSide() == Side::BUY) {
-        auto& asks = book.getAsks();
-        trades = matchAgainstSide(order, asks, book);
-    } else {
-        auto& bids = book.getBids();
-        trades = matchAgainstSide(order, bids, book);
+void OrderMatcher::matchMarketOrder(OrderPtr order, OrderBook& book,
+                                    std::pmr::vector<Trade>& trades,
+                                    std::pmr::vector<OrderPtr>* selfTradeAdjusted) {
+    if (order->getTimeInForce() == TimeInForce::FOK) {
+        const SweepLimit limit = book.getSweepLimit(order->getSide());
+        bool fillable = order->getSide() == Side::BUY
+            ? canFillCompletely(*order, book.getAsks(), limit)
+            : canFillCompletely(*order, book.getBids(), limit);
+        if (!fillable) {
+            order->cancel();
+            return;
+        }
     }
     
+    matchIncoming(order, book, trades, selfTradeAdjusted);
+    
     // IMPORTANT: Annuler le reliquat des ordres MARKET non complètement exécutés
     if (order->getRemainingQuantity() > 0) {
         order->cancel();
     }
+}
+
+namespace {
+    // Retire l'ordre en tête du niveau sans exécution (prévention d'auto-exécution)
+    void cancelFront(PriceLevel& level, OrderBook& book,
+                     std::pmr::vector<OrderPtr>* selfTradeAdjusted) {
+        size_t slot = level.beginSlot();
+        OrderPtr bookOrder = level.orderAt(slot);
+        Quantity qty = level.quantityAt(slot);
+        
+        if (bookOrder->getRemainingQuantity() > 0) {
+            bookOrder->cancel();
+        }
+        book.removeFromIndex(bookOrder->getOrderId());
+        level.popFront(slot + 1, qty);
+        if (selfTradeAdjusted) selfTradeAdjusted->push_back(std::move(bookOrder));
+    }
     
-    return trades;
+    // Iceberg dont la tranche visible en tête est épuisée : la réserve repart
+    // en fin de file du même niveau, sans passer par l'index de l'OrderBook
+    void requeueFront(PriceLevel& level) {
+        size_t slot = level.beginSlot();
+        OrderPtr bookOrder = level.orderAt(slot);
+        level.popFront(slot + 1, level.quantityAt(slot));
+        bookOrder->replenish();
+        level.addOrder(std::move(bookOrder));
+    }
+    
+    // Retire qty du slot de tête : fill partiel, ordre terminé ou nouvelle tranche iceberg
+    void consumeFront(PriceLevel& level, Quantity qty, OrderBook& book) {
+        size_t slot = level.beginSlot();
+        if (qty < level.quantityAt(slot)) {
+            level.fillSlot(slot, qty);
+        } else if (level.orderAt(slot)->getRemainingQuantity() > 0) {
+            requeueFront(level);
+        } else {
+            book.removeFromIndex(level.orderAt(slot)->getOrderId());
+            level.popFront(slot + 1, qty);
+        }
+    }
+    
+    // Attribue qty au slot (fill partiel, ordre terminé ou nouvelle tranche
+    // iceberg) sans compaction : les index des autres slots restent valides
+    template<typename Fill>
+    OrderId allocateSlot(PriceLevel& level, size_t slot, Quantity qty, OrderBook& book, Fill& fill) {
+        OrderPtr bookOrder = level.orderAt(slot);  // Copie : addOrder peut réallouer
+        OrderId bookId = fill(bookOrder, qty, level.getPrice());
+        if (qty < level.quantityAt(slot)) {
+            level.fillSlot(slot, qty);
+            return bookId;
+        }
+        level.clearSlot(slot);
+        if (bookOrder->getRemainingQuantity() > 0) {
+            bookOrder->replenish();
+            level.addOrder(std::move(bookOrder));
+        } else {
+            book.removeFromIndex(bookId);
+        }
+        return bookId;
+    }
+    
+    // Pro-rata sur un niveau qui absorbe toute la quantité (qty < quantité
+    // visible du niveau) : chaque slot reçoit floor(q * qty / base), puis le
+    // reliquat d'arrondi est attribué dans l'ordre de la file. Passes sur le
+    // seul tableau des quantités, sans tampon : la somme des parts arrondies
+    // est recalculée plutôt que stockée.
+    template<typename Policy, typename Fill>
+    OrderId allocateProRata(PriceLevel& level, Quantity qty, OrderBook& book, Fill& fill) {
+        OrderId lastCounterparty = 0;
+        size_t first = level.beginSlot();
+        const size_t end = level.endSlot();  // Les tranches iceberg remises en file sont exclues
+        
+        if constexpr (Policy::kTopOrderPriority) {
+            Quantity top = std::min(level.quantityAt(first), qty);
+            lastCounterparty = allocateSlot(level, first, top, book, fill);
+            qty -= top;
+            first++;
+        }
+        
+        if (qty > 0) {
+            Quantity base = 0;
+            for (size_t slot = first; slot < end; ++slot) base += level.quantityAt(slot);
+            
+            auto share = [&](size_t slot) {
+                return static_cast<Quantity>(
+                    static_cast<unsigned __int128>(level.quantityAt(slot)) * qty / base);
+            };
+            Quantity rounded = 0;
+            for (size_t slot = first; slot < end; ++slot) rounded += share(slot);
+            Quantity leftover = qty - rounded;
+            
+            for (size_t slot = first; slot < end; ++slot) {
+                Quantity slotQty = level.quantityAt(slot);
+                if (slotQty == 0) continue;  // Tombe
+                Quantity allocated = share(slot);
+                Quantity extra = std::min(slotQty - allocated, leftover);
+                allocated += extra;
+                leftover -= extra;
+                if (allocated > 0) {
+                    lastCounterparty = allocateSlot(level, slot, allocated, book, fill);
+                }
+            }
+        }
+        
+        level.settle();
+        return lastCounterparty;
+    }
+    
+    // Quantité exécutable d'un niveau en enchère, réserve des icebergs comprise
+    Quantity auctionQuantity(const PriceLevel& level) {
+        Quantity qty = level.getTotalQuantity();
+        if (level.hasIcebergs()) qty += level.getHiddenQuantity();
+        return qty;
+    }
+}
+
+AuctionResult OrderMatcher::computeUncross(const OrderBook& book, Price referencePrice) {
+    const BidSide& bids = book.getBids();
+    const AskSide& asks = book.getAsks();
+    AuctionResult best;
+    if (bids.isEmpty() || asks.isEmpty() || bids.getBestPrice() < asks.getBestPrice()) {
+        return best;
+    }
+    
+    // Seuls les prix de [meilleur ask, meilleur bid] peuvent exécuter du volume
+    const Price low = asks.getBestPrice();
+    const Price high = bids.getBestPrice();
+    
+    // Demande totale de la zone de croisement (bids >= low)
+    Quantity bidTotal = 0;
+    auto bidBoundary = bids.begin();
+    while (bidBoundary != bids.end() && bidBoundary->first >= low) {
+        bidTotal += auctionQuantity(bidBoundary->second);
+        ++bidBoundary;
+    }
+    
+    // Fusion croissante des prix des deux côtés : offre cumulée (asks <= p)
+    // et demande cumulée (bids >= p = total - bids < p)
+    auto askIt = asks.begin();
+    auto bidIt = std::make_reverse_iterator(bidBoundary);
+    const auto bidEnd = std::make_reverse_iterator(bids.begin());
+    Quantity askCumulative = 0;
+    Quantity bidBelow = 0;
+    
+    while (true) {
+        bool hasAsk = askIt != asks.end() && askIt->first <= high;
+        bool hasBid = bidIt != bidEnd;
+        if (!hasAsk && !hasBid) break;
+        
+        Price price = !hasBid ? askIt->first
+                    : !hasAsk ? bidIt->first
+                    : std::min(askIt->first, bidIt->first);
+        
+        if (hasAsk && askIt->first == price) {
+            askCumulative += auctionQuantity(askIt->second);
+            ++askIt;
+        }
+        Quantity bidCumulative = bidTotal - bidBelow;
+        if (hasBid && bidIt->first == price) {
+            bidBelow += auctionQuantity(bidIt->second);
+            ++bidIt;
+        }
+        
+        Quantity volume = std::min(bidCumulative, askCumulative);
+        Quantity imbalance = bidCumulative > askCumulative ? bidCumulative - askCumulative
+                                                           : askCumulative - bidCumulative;
+        bool better = volume > best.volume ||
+            (volume == best.volume && imbalance < best.imbalance) ||
+            (volume == best.volume && imbalance == best.imbalance && referencePrice > 0 &&
+             std::abs(price - referencePrice) < std::abs(best.price - referencePrice));
+        if (volume > 0 && better) {
+            best = {price, volume, imbalance};
+        }
+    }
+    return best;
+}
+
+void OrderMatcher::uncross(OrderBook& book, const AuctionResult& result,
+                           std::pmr::vector<Trade>& trades,
+                           std::pmr::vector<OrderPtr>* selfTradeAdjusted) {
+    StopBook& stops = book.getStops();
+    stops.clearTriggered();
+    if (result.volume == 0) return;
+    
+    BidSide& bids = book.getBids();
+    AskSide& asks = book.getAsks();
+    const Price price = result.price;
+    Quantity remaining = result.volume;
+    
+    // Le volume d'équilibre est couvert des deux côtés par les niveaux croisés :
+    // il suffit de consommer les têtes de file jusqu'à l'épuiser
+    while (remaining > 0) {
+        auto bidIt = bids.begin();
+        auto askIt = asks.begin();
+        PriceLevel& bidLevel = bidIt->second;
+        PriceLevel& askLevel = askIt->second;
+        const OrderPtr& buyOrder = bidLevel.orderAt(bidLevel.beginSlot());
+        const OrderPtr& sellOrder = askLevel.orderAt(askLevel.beginSlot());
+        const OrderId buyId = buyOrder->getOrderId();
+        const OrderId sellId = sellOrder->getOrderId();
+        
+        Quantity qty = std::min({bidLevel.quantityAt(bidLevel.beginSlot()),
+                                 askLevel.quantityAt(askLevel.beginSlot()), remaining});
+        buyOrder->execute(qty, price, sellId);
+        sellOrder->execute(qty, price, buyId);
+        trades.emplace_back(getCurrentTimestamp(), buyId, sellId, book.getInstrument(), qty, price);
+        remaining -= qty;
+        
+        consumeFront(bidLevel, qty, book);
+        consumeFront(askLevel, qty, book);
+        if (bidLevel.isEmpty()) bids.eraseLevel(bidIt);
+        if (askLevel.isEmpty()) asks.eraseLevel(askIt);
+    }
+    
+    book.onTrade(price);
+    while (OrderPtr triggered = stops.popTriggered()) {
+        dispatch(std::move(triggered), book, trades, selfTradeAdjusted);
+    }
+}
+
+bool OrderMatcher::crosses(const Order& order, Price levelPrice) {
+    if (order.getType() == OrderType::MARKET) {
+        return true; // Les ordres MARKET matchent à n'importe quel prix
+    }
+    if (order.getSide() == Side::BUY) {
+        return order.getPrice() >= levelPrice;
+    }
+    return order.getPrice() <= levelPrice;
 }
 
 template<typename BookSideType>
-std::vector<Trade> OrderMatcher::matchAgainstSide(OrderPtr incomingOrder, 
-                                                 BookSideType& bookSide,
-                                                 OrderBook& book) {
-    std::vector<Trade> trades;
-    std::vector<OrderId> ordersToRemove; // Pour éviter de modifier pendant l'itération
+bool OrderMatcher::canFillCompletely(const Order& order, const BookSideType& bookSide,
+                                     const SweepLimit& limit) {
+    const OwnerId owner = order.getOwner();
+    const SelfTradePrevention stp = order.getSelfTradePrevention();
+    const bool checkSelfTrade = owner != 0 && stp != SelfTradePrevention::NONE;
+    const bool isBuy = order.getSide() == Side::BUY;
+    Quantity needed = order.getRemainingQuantity();
+    size_t levelsLeft = limit.maxLevels;
+    
+    for (const auto& [price, level] : bookSide) {
+        if (!crosses(order, price)) break;
+        // Les niveaux hors bande ou au-delà du plafond ne seront pas atteints
+        if ((isBuy ? price > limit.bound : price < limit.bound) || levelsLeft-- == 0) break;
+        
+        // Cas courant : un test par niveau sur la quantité agrégée (la
+        // réserve des icebergs n'est comptée que si le visible ne suffit pas)
+        if (!checkSelfTrade) {
+            Quantity available = level.getTotalQuantity();
+            if (available < needed && level.hasIcebergs()) {
+                available += level.getHiddenQuantity();
+            }
+            if (available >= needed) return true;
+            needed -= available;
+            continue;
+        }
+        
+        // Ordres du même propriétaire : exclus (CANCEL_OLDEST) ou bloquants.
+        // Seule la tranche visible est exécutée à sa place ; la réserve des
+        // icebergs repasse en fin de niveau, derrière les ordres suivants
+        Quantity hidden = 0;
+        for (size_t slot = level.beginSlot(); slot < level.endSlot(); ++slot) {
+            Quantity qty = level.quantityAt(slot);
+            if (qty == 0) continue;
+            if (level.ownerAt(slot) == owner) {
+                if (stp == SelfTradePrevention::CANCEL_OLDEST) continue;
+                return false;
+            }
+            if (qty >= needed) return true;
+            needed -= qty;
+            if (level.hasIcebergs()) hidden += level.orderAt(slot)->getRemainingQuantity() - qty;
+        }
+        if (hidden >= needed) return true;
+        needed -= hidden;
+    }
+    return false;
+}
+
+template<typename Policy, typename BookSideType>
+void OrderMatcher::matchAgainstSide(OrderPtr incomingOrder, 
+                                   BookSideType& bookSide,
+                                   OrderBook& book,
+                                   std::pmr::vector<Trade>& trades,
+                                   std::pmr::vector<OrderPtr>* selfTradeAdjusted) {
+    const OrderId incomingId = incomingOrder->getOrderId();
+    const bool incomingIsBuy = incomingOrder->getSide() == Side::BUY;
+    const OwnerId owner = incomingOrder->getOwner();
+    const SelfTradePrevention stp = incomingOrder->getSelfTradePrevention();
+    const bool checkSelfTrade = owner != 0 && stp != SelfTradePrevention::NONE;
+    
+    // Effets de la prévention d'auto-exécution sur l'ordre entrant, appliqués
+    // après son execute() pour ne pas écraser le statut annulé
+    Quantity incomingDecrement = 0;
+    bool cancelIncoming = false;
+    
+    // Bande de prix et plafond de niveaux : le balayage s'arrête avant le
+    // premier niveau hors bornes et le reliquat est annulé (un LIMIT ne
+    // reste pas au carnet en croisant le côté opposé)
+    const SweepLimit limit = book.getSweepLimit(incomingOrder->getSide());
+    size_t levelsLeft = limit.maxLevels;
+    
+    auto fill = [&](const OrderPtr& bookOrder, Quantity matchQty, Price levelPrice) {
+        OrderId bookId = bookOrder->getOrderId();
+        
+        // Exécuter l'ordre du carnet au prix du niveau (prix du book)
+        bookOrder->execute(matchQty, levelPrice, incomingId);
+        trades.emplace_back(
+            getCurrentTimestamp(),
+            incomingIsBuy ? incomingId : bookId,
+            incomingIsBuy ? bookId : incomingId,
+            book.getInstrument(),
+            matchQty,
+            levelPrice,
+            incomingId
+        );
+        return bookId;
+    };
     
     auto it = bookSide.begin();
-    while (it != bookSide.end() && incomingOrder->getRemainingQuantity() > 0) {
-        PriceLevel* level = it->second.get();
+    while (it != bookSide.end() && incomingOrder->getRemainingQuantity() > 0 && !cancelIncoming) {
+        PriceLevel* level = &it->second;
         Price levelPrice = level->getPrice();
         
         // Vérifier si les prix se croisent
-        bool priceMatch = false;
-        if (incomingOrder->getType() == OrderType::MARKET) {
-            priceMatch = true; // Les ordres MARKET matchent à n'importe quel prix
-        } else if (incomingOrder->getSide() == Side::BUY) {
-            priceMatch = incomingOrder->getPrice() >= levelPrice;
-        } else {
-            priceMatch = incomingOrder->getPrice() <= levelPrice;
+        if (!crosses(*incomingOrder, levelPrice)) break;
+        if (incomingIsBuy ? levelPrice > limit.bound : levelPrice < limit.bound) {
+            book.flagBandBreach();
+            cancelIncoming = true;
+            break;
+        }
+        if (levelsLeft-- == 0) {
+            cancelIncoming = true;
+            break;
         }
         
-        if (!priceMatch) break;
+        Quantity remaining = incomingOrder->getRemainingQuantity() - incomingDecrement;
+        Quantity levelFilled = 0;
+        OrderId lastCounterparty = 0;
         
-        // Matcher contre les ordres du niveau
-        auto orderIt = level->begin();
-        while (orderIt != level->end() && incomingOrder->getRemainingQuantity() > 0) {
-            OrderPtr bookOrder = *orderIt;
+        while (remaining > 0 && !level->isEmpty()) {
+            // Pro-rata : seulement si le niveau absorbe tout le reste (sinon il
+            // est consommé entièrement, comme en FIFO) et sans ordre du même
+            // propriétaire (la prévention d'auto-exécution suit alors la file)
+            if constexpr (Policy::kProRata) {
+                if (remaining < level->getTotalQuantity() &&
+                    (!checkSelfTrade || level->findOwner(owner, level->endSlot()) == level->endSlot())) {
+                    lastCounterparty = allocateProRata<Policy>(*level, remaining, book, fill);
+                    levelFilled += remaining;
+                    remaining = 0;
+                    break;
+                }
+            }
             
-            Quantity matchQty = std::min(incomingOrder->getRemainingQuantity(), 
-                                       bookOrder->getRemainingQuantity());
+            // Somme préfixe sur les quantités : tous les slots de [begin, end)
+            // sont consommés entièrement et peuvent être exécutés en bloc
+            Quantity consumed = 0;
+            size_t endSlot = level->findConsumedEnd(remaining, &consumed);
             
-            // Exécuter les deux ordres au prix du niveau (prix du book)
-            incomingOrder->execute(matchQty, levelPrice, bookOrder->getOrderId());
-            bookOrder->execute(matchQty, levelPrice, incomingOrder->getOrderId());
+            // Auto-exécution : premier ordre du même propriétaire parmi ceux
+            // que l'ordre entrant toucherait (fill partiel final compris)
+            size_t stopSlot = endSlot;
+            if (checkSelfTrade) {
+                // Pas de fill partiel si le niveau entier est consommé
+                size_t touchedEnd = consumed < remaining && endSlot < level->endSlot() ? endSlot + 1 : endSlot;
+                stopSlot = level->findOwner(owner, touchedEnd);
+                if (stopSlot == touchedEnd) stopSlot = endSlot;
+            }
             
-            // Créer le trade
-            Trade trade(
-                getCurrentTimestamp(),
-                incomingOrder->getSide() == Side::BUY ? incomingOrder->getOrderId() : bookOrder->getOrderId(),
-                incomingOrder->getSide() == Side::SELL ? incomingOrder->getOrderId() : bookOrder->getOrderId(),
-                book.getInstrument(),
-                matchQty,
-                levelPrice
-            );
-            trades.push_back(trade);
+            Quantity filled = 0;
+            bool requeued = false;
+            for (size_t slot = level->beginSlot(); slot < stopSlot; ++slot) {
+                const OrderPtr& bookOrder = level->orderAt(slot);
+                if (!bookOrder) continue; // Slot annulé
+                
+                Quantity matchQty = level->quantityAt(slot);
+                lastCounterparty = fill(bookOrder, matchQty, levelPrice);
+                filled += matchQty;
+                
+                if (bookOrder->getRemainingQuantity() > 0) {
+                    // Iceberg : tranche épuisée, nouvelle tranche en fin de file
+                    // (au-delà de stopSlot, elle ne sera touchée qu'au passage suivant)
+                    OrderPtr replenished = bookOrder;
+                    replenished->replenish();
+                    level->addOrder(std::move(replenished));
+                    requeued = true;
+                } else {
+                    book.removeFromIndex(lastCounterparty);
+                }
+            }
+            level->popFront(stopSlot, filled);
+            levelFilled += filled;
+            remaining -= filled;
             
-            // Marquer l'ordre pour suppression s'il est complètement exécuté
-            if (!bookOrder->isActive()) {
-                ordersToRemove.push_back(bookOrder->getOrderId());
+            if (remaining == 0 || level->isEmpty()) break;
+            // Des tranches ajoutées en fin de file peuvent être consommées en bloc
+            if (requeued) continue;
+            
+            size_t front = level->beginSlot();
+            if (!checkSelfTrade || level->ownerAt(front) != owner) {
+                // Fill partiel du premier ordre qui n'est pas consommé entièrement
+                lastCounterparty = fill(level->orderAt(front), remaining, levelPrice);
+                level->fillSlot(front, remaining);
+                levelFilled += remaining;
+                remaining = 0;
+                break;
             }
             
-            ++orderIt;
+            // L'ordre en tête appartient au même propriétaire
+            if (stp == SelfTradePrevention::CANCEL_NEWEST) {
+                cancelIncoming = true;
+                break;
+            }
+            if (stp == SelfTradePrevention::CANCEL_BOTH) {
+                cancelFront(*level, book, selfTradeAdjusted);
+                cancelIncoming = true;
+                break;
+            }
+            if (stp == SelfTradePrevention::CANCEL_OLDEST) {
+                cancelFront(*level, book, selfTradeAdjusted);
+                continue;
+            }
+            
+            // DECREMENT_AND_CANCEL : les deux réduits de la plus petite quantité
+            // (réserve d'un iceberg comprise)
+            OrderPtr bookOrder = level->orderAt(front);
+            Quantity decrement = std::min(bookOrder->getRemainingQuantity(), remaining);
+            bookOrder->decrement(decrement);
+            if (decrement < level->quantityAt(front)) {
+                level->fillSlot(front, decrement);
+                if (selfTradeAdjusted) selfTradeAdjusted->push_back(std::move(bookOrder));
+            } else if (bookOrder->isActive()) {
+                requeueFront(*level);
+                if (selfTradeAdjusted) selfTradeAdjusted->push_back(std::move(bookOrder));
+            } else {
+                cancelFront(*level, book, selfTradeAdjusted);
+            }
+            incomingDecrement += decrement;
+            remaining -= decrement;
+        }
+        
+        // Un seul execute() pour l'ordre entrant par niveau
+        if (levelFilled > 0) {
+            incomingOrder->execute(levelFilled, levelPrice, lastCounterparty);
+            book.onTrade(levelPrice);  // Test O(1) des frontières de stops
+        }
+        
+        if (level->isEmpty()) {
+            it = bookSide.eraseLevel(it);
+        } else {
+            ++it;
         }
         
-        ++it;
+        if (incomingOrder->getRemainingQuantity() == incomingDecrement) break;
     }
     
-    // Supprimer les ordres exécutés après l'itération
-    for (OrderId orderId : ordersToRemove) {
-        book.removeOrder(orderId);
+    if (incomingDecrement > 0) {
+        incomingOrder->decrement(incomingDecrement);
+    }
+    if (cancelIncoming && incomingOrder->isActive()) {
+        incomingOrder->cancel();
     }
-    
-    return trades;
 }
 
 // Instanciation explicite des templates
-template std::vector<Trade> OrderMatcher::matchAgainstSide<BidSide>(
-    OrderPtr, BidSide&, OrderBook&);
-template std::vector<Trade> OrderMatcher::matchAgainstSide<AskSide>(
-    OrderPtr, AskSide&, OrderBook&);
\ No newline at end of file
+template bool OrderMatcher::canFillCompletely<BidSide>(const Order&, const BidSide&, const SweepLimit&);
+template bool OrderMatcher::canFillCompletely<AskSide>(const Order&, const AskSide&, const SweepLimit&);
+template void OrderMatcher::matchAgainstSide<FifoAllocation, BidSide>(
+    OrderPtr, BidSide&, OrderBook&, std::pmr::vector<Trade>&, std::pmr::vector<OrderPtr>*);
+template void OrderMatcher::matchAgainstSide<FifoAllocation, AskSide>(
+    OrderPtr, AskSide&, OrderBook&, std::pmr::vector<Trade>&, std::pmr::vector<OrderPtr>*);
+template void OrderMatcher::matchAgainstSide<ProRataAllocation, BidSide>(
+    OrderPtr, BidSide&, OrderBook&, std::pmr::vector<Trade>&, std::pmr::vector<OrderPtr>*);
+template void OrderMatcher::matchAgainstSide<ProRataAllocation, AskSide>(
+    OrderPtr, AskSide&, OrderBook&, std::pmr::vector<Trade>&, std::pmr::vector<OrderPtr>*);
+template void OrderMatcher::matchAgainstSide<TopOrderProRataAllocation, BidSide>(
+    OrderPtr, BidSide&, OrderBook&, std::pmr::vector<Trade>&, std::pmr::vector<OrderPtr>*);
+template void OrderMatcher::matchAgainstSide<TopOrderProRataAllocation, AskSide>(
+    OrderPtr, AskSide&, OrderBook&, std::pmr::vector<Trade>&, std::pmr::vector<OrderPtr>*);
@@ -1,31 +1,177 @@
-
-
 // ===== src/core/PriceLevel.cpp =====
 #include "core/PriceLevel.hpp"
 #include "exceptions/Exceptions.hpp"
 
-PriceLevel::PriceLevel(Price price) 
-    : price_(price), totalQuantity_(0) {}
+namespace {
+    // Taille de bloc pour la somme préfixe : la réduction d'un bloc est
+    // vectorisée par le compilateur, le scan scalaire n'a lieu que dans
+    // le bloc qui dépasse la quantité demandée.
+    constexpr size_t kSumBlock = 8;
+    // En dessous de ce nombre de slots, la compaction n'en vaut pas la peine
+    constexpr size_t kCompactThreshold = 32;
+}
+
+PriceLevel::PriceLevel(Price price, const allocator_type& alloc) 
+    : price_(price), quantities_(alloc), ids_(alloc), orders_(alloc), owners_(alloc),
+      head_(0), activeCount_(0), totalQuantity_(0), icebergCount_(0) {}
 
 void PriceLevel::addOrder(OrderPtr order) {
-    orders_.push_back(order);
-    totalQuantity_ += order->getRemainingQuantity();
+    Quantity qty = order->getVisibleQuantity();
+    if (order->isIceberg()) icebergCount_++;
+    quantities_.push_back(qty);
+    ids_.push_back(order->getOrderId());
+    owners_.push_back(order->getOwner());
+    orders_.push_back(std::move(order));
+    totalQuantity_ += qty;
+    activeCount_++;
 }
 
 void PriceLevel::removeOrder(OrderId orderId) {
-    auto it = std::find_if(orders_.begin(), orders_.end(),
-        [orderId](const OrderPtr& order) { 
-            return order->getOrderId() == orderId; 
-        });
+    auto first = ids_.begin() + head_;
+    auto it = std::find(first, ids_.end(), orderId);
     
-    if (it == orders_.end()) {
+    if (it == ids_.end()) {
         throw OrderNotFoundException(orderId);
     }
     
-    totalQuantity_ -= (*it)->getRemainingQuantity();
-    orders_.erase(it);
+    size_t slot = it - ids_.begin();
+    clearSlot(slot);
+    
+    if (activeCount_ == 0) {
+        compact();
+    } else if (slot == head_) {
+        while (!orders_[head_]) head_++;
+    } else if (orders_.size() - head_ > kCompactThreshold &&
+               activeCount_ * 2 < orders_.size() - head_) {
+        compact();
+    }
+}
+
+void PriceLevel::reduceOrder(OrderId orderId) {
+    auto first = ids_.begin() + head_;
+    auto it = std::find(first, ids_.end(), orderId);
+    
+    if (it == ids_.end()) {
+        throw OrderNotFoundException(orderId);
+    }
+    
+    size_t slot = it - ids_.begin();
+    Quantity visible = orders_[slot]->getVisibleQuantity();
+    totalQuantity_ -= quantities_[slot] - visible;
+    quantities_[slot] = visible;
+}
+
+void PriceLevel::clearSlot(size_t slot) {
+    if (orders_[slot]->isIceberg()) icebergCount_--;
+    totalQuantity_ -= quantities_[slot];
+    quantities_[slot] = 0;
+    ids_[slot] = 0;
+    owners_[slot] = 0;
+    orders_[slot].reset();
+    activeCount_--;
+}
+
+void PriceLevel::settle() {
+    if (activeCount_ == 0) {
+        compact();
+        return;
+    }
+    while (!orders_[head_]) head_++;
+    if (orders_.size() - head_ > kCompactThreshold && activeCount_ * 2 < orders_.size() - head_) {
+        compact();
+    }
 }
 
 OrderPtr PriceLevel::getFrontOrder() const {
-    return orders_.empty() ? nullptr : orders_.front();
-}
\ No newline at end of file
+    for (size_t slot = head_; slot < orders_.size(); ++slot) {
+        if (orders_[slot]) return orders_[slot];
+    }
+    return nullptr;
+}
+
+size_t PriceLevel::findConsumedEnd(Quantity qty, Quantity* consumed) const {
+    const Quantity* q = quantities_.data();
+    size_t slot = head_;
+    size_t size = quantities_.size();
+    Quantity sum = 0;
+    
+    // Avancer par blocs entiers tant que le bloc est absorbé
+    while (slot + kSumBlock <= size) {
+        Quantity blockSum = 0;
+        for (size_t i = 0; i < kSumBlock; ++i) {
+            blockSum += q[slot + i];
+        }
+        if (sum + blockSum > qty) break;
+        sum += blockSum;
+        slot += kSumBlock;
+    }
+    
+    // Scan scalaire dans le bloc qui dépasse (ou la fin du tableau)
+    while (slot < size && sum + q[slot] <= qty) {
+        sum += q[slot];
+        slot++;
+    }
+    if (consumed) *consumed = sum;
+    return slot;
+}
+
+void PriceLevel::fillSlot(size_t slot, Quantity qty) {
+    quantities_[slot] -= qty;
+    totalQuantity_ -= qty;
+}
+
+void PriceLevel::popFront(size_t end, Quantity filledQuantity) {
+    for (size_t slot = head_; slot < end; ++slot) {
+        if (orders_[slot]) {
+            if (orders_[slot]->isIceberg()) icebergCount_--;
+            orders_[slot].reset();
+            activeCount_--;
+        }
+        quantities_[slot] = 0;
+        ids_[slot] = 0;
+        owners_[slot] = 0;
+    }
+    totalQuantity_ -= filledQuantity;
+    head_ = end;
+    
+    if (activeCount_ == 0 || head_ * 2 > orders_.size()) {
+        compact();
+    } else {
+        while (!orders_[head_]) head_++;
+    }
+}
+
+Quantity PriceLevel::getHiddenQuantity() const {
+    Quantity hidden = 0;
+    for (size_t slot = head_; slot < orders_.size(); ++slot) {
+        if (orders_[slot] && orders_[slot]->isIceberg()) {
+            hidden += orders_[slot]->getRemainingQuantity() - quantities_[slot];
+        }
+    }
+    return hidden;
+}
+
+size_t PriceLevel::findOwner(OwnerId owner, size_t end) const {
+    const OwnerId* o = owners_.data();
+    for (size_t slot = head_; slot < end; ++slot) {
+        if (o[slot] == owner) return slot;
+    }
+    return end;
+}
+
+void PriceLevel::compact() {
+    size_t out = 0;
+    for (size_t slot = head_; slot < orders_.size(); ++slot) {
+        if (!orders_[slot]) continue;
+        quantities_[out] = quantities_[slot];
+        ids_[out] = ids_[slot];
+        owners_[out] = owners_[slot];
+        orders_[out] = std::move(orders_[slot]);
+        out++;
+    }
+    quantities_.resize(out);
+    ids_.resize(out);
+    owners_.resize(out);
+    orders_.resize(out);
+    head_ = 0;
+}
@@ -0,0 +1,90 @@
+// ===== src/core/RiskChecker.cpp =====
+#include "core/RiskChecker.hpp"
+#include "core/OrderBook.hpp"
+
+namespace {
+    // Prix de référence d'un ordre agressif : meilleur prix opposé, à défaut
+    // le dernier prix échangé (0 = aucune référence)
+    Price referencePrice(const OrderBook& book, Side side) {
+        Price opposite = side == Side::BUY ? book.getBestAsk() : book.getBestBid();
+        return opposite > 0 ? opposite : book.getLastTradePrice();
+    }
+}
+
+RiskRejection RiskChecker::check(const OrderBook& book, Side side, OrderType type, Quantity quantity,
+                                 Price price, OwnerId owner, const Order* replaced) const {
+    // Une modification doit laisser un reste à exécuter
+    if ((limits_.maxOrderQuantity > 0 && quantity > limits_.maxOrderQuantity) ||
+        (replaced && quantity <= replaced->getExecutedQuantity())) {
+        return RiskRejection::ORDER_SIZE;
+    }
+    
+    Price reference = referencePrice(book, side);
+    if (type == OrderType::LIMIT && limits_.priceCollar > 0 && reference > 0) {
+        bool outside = side == Side::BUY ? price > reference * (1 + limits_.priceCollar)
+                                         : price < reference * (1 - limits_.priceCollar);
+        if (outside) return RiskRejection::PRICE_COLLAR;
+    }
+    
+    if (owner == 0 || (limits_.maxPosition == 0 && limits_.maxOpenNotional <= 0)) {
+        return RiskRejection::NONE;
+    }
+    
+    AccountExposure exposure;
+    if (const AccountExposure* account = findAccount(owner)) exposure = *account;
+    
+    // Un ordre modifié libère d'abord ce qu'il comptait déjà
+    Quantity open = quantity;
+    if (replaced) {
+        open = quantity - replaced->getExecutedQuantity();
+        (side == Side::BUY ? exposure.openBuy : exposure.openSell) -= replaced->getRiskQuantity();
+        exposure.openNotional -= replaced->getRiskQuantity() * replaced->getRiskPrice();
+    }
+    
+    if (limits_.maxPosition > 0) {
+        int64_t worst = side == Side::BUY
+            ? exposure.position + static_cast<int64_t>(exposure.openBuy + open)
+            : static_cast<int64_t>(exposure.openSell + open) - exposure.position;
+        if (worst > static_cast<int64_t>(limits_.maxPosition)) return RiskRejection::POSITION;
+    }
+    
+    if (limits_.maxOpenNotional > 0) {
+        Price notionalPrice = type == OrderType::LIMIT ? price : reference;
+        if (exposure.openNotional + open * notionalPrice > limits_.maxOpenNotional) {
+            return RiskRejection::OPEN_NOTIONAL;
+        }
+    }
+    return RiskRejection::NONE;
+}
+
+void RiskChecker::onFill(const Order& buyOrder, const Order& sellOrder, Quantity quantity) {
+    if (buyOrder.getOwner() != 0) accounts_[buyOrder.getOwner()].position += static_cast<int64_t>(quantity);
+    if (sellOrder.getOwner() != 0) accounts_[sellOrder.getOwner()].position -= static_cast<int64_t>(quantity);
+}
+
+void RiskChecker::reconcile(Order& order) {
+    if (order.getOwner() == 0) return;
+    
+    Quantity open = order.isActive() ? order.getRemainingQuantity() : 0;
+    Price price = order.getPrice();
+    if (open == order.getRiskQuantity() && price == order.getRiskPrice()) return;
+    
+    AccountExposure& account = accounts_[order.getOwner()];
+    Quantity& openSide = order.getSide() == Side::BUY ? account.openBuy : account.openSell;
+    openSide = openSide - order.getRiskQuantity() + open;
+    account.openNotional += open * price - order.getRiskQuantity() * order.getRiskPrice();
+    order.setRiskExposure(open, price);
+}
+
+void RiskChecker::clearOpenExposure() {
+    for (auto& [owner, account] : accounts_) {
+        account.openBuy = 0;
+        account.openSell = 0;
+        account.openNotional = 0;
+    }
+}
+
+const AccountExposure* RiskChecker::findAccount(OwnerId owner) const {
+    auto it = accounts_.find(owner);
+    return it != accounts_.end() ? &it->second : nullptr;
+}
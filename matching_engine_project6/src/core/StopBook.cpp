@@ -0,0 +1,93 @@
+// ===== src/core/StopBook.cpp =====
+#include "core/StopBook.hpp"
+#include <algorithm>
+
+namespace {
+    constexpr Price kNoBuyTrigger = std::numeric_limits<Price>::infinity();
+    constexpr Price kNoSellTrigger = -std::numeric_limits<Price>::infinity();
+
+    template<typename StopMap>
+    bool eraseFrom(StopMap& stops, Price stopPrice, OrderId orderId) {
+        auto level = stops.find(stopPrice);
+        if (level == stops.end()) return false;
+
+        auto& bucket = level->second;
+        auto it = std::find_if(bucket.begin(), bucket.end(),
+                               [orderId](const OrderPtr& o) { return o->getOrderId() == orderId; });
+        if (it == bucket.end()) return false;
+
+        bucket.erase(it);
+        if (bucket.empty()) stops.erase(level);
+        return true;
+    }
+}
+
+StopBook::StopBook(const allocator_type& alloc)
+    : buyStops_(alloc), sellStops_(alloc), index_(alloc),
+      buyTrigger_(kNoBuyTrigger), sellTrigger_(kNoSellTrigger),
+      triggered_(alloc), triggeredHead_(0) {}
+
+void StopBook::addOrder(OrderPtr order) {
+    Price stopPrice = order->getStopPrice();
+    index_[order->getOrderId()] = order;
+
+    if (order->getSide() == Side::BUY) {
+        buyStops_.try_emplace(stopPrice).first->second.push_back(std::move(order));
+    } else {
+        sellStops_.try_emplace(stopPrice).first->second.push_back(std::move(order));
+    }
+    updateTriggers();
+}
+
+bool StopBook::removeOrder(OrderId orderId) {
+    auto it = index_.find(orderId);
+    if (it == index_.end()) return false;
+
+    const OrderPtr& order = it->second;
+    if (order->getSide() == Side::BUY) {
+        eraseFrom(buyStops_, order->getStopPrice(), orderId);
+    } else {
+        eraseFrom(sellStops_, order->getStopPrice(), orderId);
+    }
+    index_.erase(it);
+    updateTriggers();
+    return true;
+}
+
+OrderPtr StopBook::findOrder(OrderId orderId) const {
+    auto it = index_.find(orderId);
+    return (it != index_.end()) ? it->second : nullptr;
+}
+
+bool StopBook::isTriggeredBy(const Order& order, Price lastPrice) {
+    if (lastPrice <= 0) return false;  // Aucun trade de référence
+    return order.getSide() == Side::BUY ? lastPrice >= order.getStopPrice()
+                                        : lastPrice <= order.getStopPrice();
+}
+
+void StopBook::collect(Price lastPrice) {
+    // Stops d'achat du plus bas au plus haut, puis stops de vente du plus haut
+    // au plus bas ; priorité temps à l'intérieur d'un même prix
+    while (!buyStops_.empty() && buyStops_.begin()->first <= lastPrice) {
+        for (auto& order : buyStops_.begin()->second) {
+            index_.erase(order->getOrderId());
+            order->trigger();
+            triggered_.push_back(std::move(order));
+        }
+        buyStops_.erase(buyStops_.begin());
+    }
+    while (!sellStops_.empty() && sellStops_.begin()->first >= lastPrice) {
+        for (auto& order : sellStops_.begin()->second) {
+            index_.erase(order->getOrderId());
+            order->trigger();
+            triggered_.push_back(std::move(order));
+        }
+        sellStops_.erase(sellStops_.begin());
+    }
+    updateTriggers();
+}
+
+void StopBook::updateTriggers() {
+    buyTrigger_ = buyStops_.empty() ? kNoBuyTrigger : buyStops_.begin()->first;
+    sellTrigger_ = sellStops_.empty() ? kNoSellTrigger : sellStops_.begin()->first;
+}
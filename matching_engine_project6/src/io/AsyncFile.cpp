@@ -0,0 +1,379 @@
+// ===== src/io/AsyncFile.cpp =====
+#include "io/AsyncFile.hpp"
+#include "exceptions/Exceptions.hpp"
+#include "utils/Logger.hpp"
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+const char* ioBackendName(IoBackend backend) {
+    return backend == IoBackend::URING ? "io_uring" : "pread/pwrite";
+}
+
+// Anneau io_uring minimal : une file de soumission et une file de complétion
+// projetées en mémoire, un seul thread soumet et récolte
+class IoUring {
+private:
+    int fd_ = -1;
+    void* sqRing_ = MAP_FAILED;
+    size_t sqRingBytes_ = 0;
+    void* cqRing_ = MAP_FAILED;
+    size_t cqRingBytes_ = 0;
+    io_uring_sqe* sqes_ = nullptr;
+    size_t sqesBytes_ = 0;
+    unsigned* sqHead_ = nullptr;
+    unsigned* sqTail_ = nullptr;
+    unsigned sqMask_ = 0;
+    unsigned* sqArray_ = nullptr;
+    unsigned* cqHead_ = nullptr;
+    unsigned* cqTail_ = nullptr;
+    unsigned cqMask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+    
+    int enter(unsigned toSubmit, unsigned minComplete, unsigned flags) {
+        return static_cast<int>(::syscall(__NR_io_uring_enter, fd_, toSubmit, minComplete, flags, nullptr, 0));
+    }
+
+public:
+    // nullptr si io_uring est indisponible ou trop ancien (IORING_OP_READ/WRITE : Linux 5.6)
+    static std::unique_ptr<IoUring> create(unsigned entries) {
+        io_uring_params params{};
+        int fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd < 0) return nullptr;
+        
+        std::unique_ptr<IoUring> ring(new IoUring());
+        ring->fd_ = fd;
+        if (!(params.features & IORING_FEAT_RW_CUR_POS)) return nullptr;
+        
+        ring->sqRingBytes_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        ring->cqRingBytes_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+            ring->sqRingBytes_ = ring->cqRingBytes_ = std::max(ring->sqRingBytes_, ring->cqRingBytes_);
+        }
+        ring->sqRing_ = ::mmap(nullptr, ring->sqRingBytes_, PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if (ring->sqRing_ == MAP_FAILED) return nullptr;
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+            ring->cqRing_ = ring->sqRing_;
+        } else {
+            ring->cqRing_ = ::mmap(nullptr, ring->cqRingBytes_, PROT_READ | PROT_WRITE,
+                                   MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+            if (ring->cqRing_ == MAP_FAILED) return nullptr;
+        }
+        ring->sqesBytes_ = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = ::mmap(nullptr, ring->sqesBytes_, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) return nullptr;
+        ring->sqes_ = static_cast<io_uring_sqe*>(sqes);
+        
+        char* sq = static_cast<char*>(ring->sqRing_);
+        char* cq = static_cast<char*>(ring->cqRing_);
+        ring->sqHead_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        ring->sqTail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        ring->sqMask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        ring->sqArray_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        ring->cqHead_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        ring->cqTail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        ring->cqMask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        ring->cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        return ring;
+    }
+    
+    ~IoUring() {
+        if (sqes_) ::munmap(sqes_, sqesBytes_);
+        if (cqRing_ != MAP_FAILED && cqRing_ != sqRing_) ::munmap(cqRing_, cqRingBytes_);
+        if (sqRing_ != MAP_FAILED) ::munmap(sqRing_, sqRingBytes_);
+        if (fd_ >= 0) ::close(fd_);
+    }
+    
+    // L'appelant borne les opérations en vol au nombre d'entrées de l'anneau.
+    // En cas d'échec, l'entrée est retirée de la file : l'appelant peut
+    // réutiliser le tampon sans qu'un appel suivant ne la soumette
+    bool submit(uint8_t opcode, int fd, void* buffer, size_t length, uint64_t offset, uint64_t userData) {
+        unsigned tail = *sqTail_;
+        unsigned index = tail & sqMask_;
+        io_uring_sqe& sqe = sqes_[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = opcode;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<uint64_t>(buffer);
+        sqe.len = static_cast<uint32_t>(length);
+        sqe.off = offset;
+        sqe.user_data = userData;
+        sqArray_[index] = index;
+        __atomic_store_n(sqTail_, tail + 1, __ATOMIC_RELEASE);
+        
+        while (true) {
+            int submitted = enter(1, 0, 0);
+            if (submitted > 0) return true;
+            if (submitted == 0 || (errno != EINTR && errno != EAGAIN)) break;
+        }
+        // Entrée consommée malgré l'erreur : sa complétion arrivera
+        if (__atomic_load_n(sqHead_, __ATOMIC_ACQUIRE) != tail) return true;
+        __atomic_store_n(sqTail_, tail, __ATOMIC_RELEASE);
+        return false;
+    }
+    
+    // Attend une complétion : (user_data, résultat ou -errno)
+    bool wait(uint64_t& userData, int& result) {
+        while (true) {
+            unsigned head = *cqHead_;
+            if (head != __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE)) {
+                const io_uring_cqe& cqe = cqes_[head & cqMask_];
+                userData = cqe.user_data;
+                result = cqe.res;
+                __atomic_store_n(cqHead_, head + 1, __ATOMIC_RELEASE);
+                return true;
+            }
+            if (enter(0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR) return false;
+        }
+    }
+};
+
+namespace {
+    std::unique_ptr<IoUring> openRing(const AsyncIoConfig& config, const std::string& filename) {
+        if (config.backend != IoBackend::URING) return nullptr;
+        std::unique_ptr<IoUring> ring = IoUring::create(static_cast<unsigned>(config.depth));
+        if (!ring) {
+            Logger::log("io_uring unavailable for " + filename + ", falling back to pread/pwrite",
+                        LogLevel::WARNING);
+        }
+        return ring;
+    }
+}
+
+// ===== AsyncFileReader =====
+
+AsyncFileReader::AsyncFileReader(const std::string& filename, const AsyncIoConfig& config)
+    : filename_(filename), fd_(-1), size_(0), nextOffset_(0), current_(0), started_(false) {
+    fd_ = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd_ < 0) {
+        throw FileIOException(filename, "open");
+    }
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) {
+        ::close(fd_);
+        throw FileIOException(filename, "stat");
+    }
+    size_ = static_cast<uint64_t>(st.st_size);
+    ::posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+    
+    ring_ = openRing(config, filename);
+    // Sans anneau, un seul bloc : pas de lecture en avance possible
+    blocks_.resize(ring_ ? std::max<size_t>(config.depth, 1) : 1);
+    for (Block& block : blocks_) {
+        block.data.resize(std::max<size_t>(config.blockBytes, 1));
+    }
+}
+
+AsyncFileReader::~AsyncFileReader() {
+    // Le noyau écrit encore dans les blocs en vol : attendre avant de les libérer
+    if (ring_) {
+        uint64_t index;
+        int result;
+        while (std::any_of(blocks_.begin(), blocks_.end(), [](const Block& b) { return b.pending; }) &&
+               ring_->wait(index, result)) {
+            if (index < blocks_.size()) blocks_[index].pending = false;
+        }
+    }
+    ring_.reset();
+    ::close(fd_);
+}
+
+void AsyncFileReader::submit(Block& block) {
+    block.offset = nextOffset_;
+    block.length = std::min<uint64_t>(block.data.size(), size_ - std::min(nextOffset_, size_));
+    nextOffset_ += block.length;
+    block.pending = block.length > 0;
+    if (block.pending && ring_) {
+        uint64_t index = static_cast<uint64_t>(&block - blocks_.data());
+        if (!ring_->submit(IORING_OP_READ, fd_, block.data.data(), block.length, block.offset, index)) {
+            block.pending = false;
+            throw FileIOException(filename_, "io_uring submit");
+        }
+    }
+}
+
+void AsyncFileReader::complete(uint64_t index, int result) {
+    Block& block = blocks_[index];
+    block.pending = false;
+    if (result < 0) {
+        throw FileIOException(filename_, "read");
+    }
+    // Lecture courte : la suite est lue directement
+    if (static_cast<size_t>(result) < block.length) {
+        readSync(block, static_cast<size_t>(result));
+    }
+}
+
+void AsyncFileReader::readSync(Block& block, size_t from) {
+    while (from < block.length) {
+        ssize_t n = ::pread(fd_, block.data.data() + from, block.length - from,
+                            static_cast<off_t>(block.offset + from));
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) {
+            throw FileIOException(filename_, "read");
+        }
+        if (n == 0) {
+            block.length = from;  // Fichier tronqué pendant la lecture
+            break;
+        }
+        from += static_cast<size_t>(n);
+    }
+}
+
+std::string_view AsyncFileReader::next() {
+    if (!started_) {
+        started_ = true;
+        for (Block& block : blocks_) {
+            submit(block);
+        }
+        current_ = 0;
+    } else {
+        // Le bloc rendu au dernier appel est consommé : il repart en fin de file
+        submit(blocks_[current_]);
+        current_ = (current_ + 1) % blocks_.size();
+    }
+    
+    Block& block = blocks_[current_];
+    if (block.length == 0) return {};
+    if (ring_) {
+        uint64_t index;
+        int result;
+        while (block.pending) {
+            if (!ring_->wait(index, result)) {
+                throw FileIOException(filename_, "io_uring wait");
+            }
+            complete(index, result);
+        }
+    } else {
+        readSync(block, 0);
+        block.pending = false;
+    }
+    return {block.data.data(), block.length};
+}
+
+// ===== AsyncFileWriter =====
+
+AsyncFileWriter::AsyncFileWriter(const std::string& filename, const AsyncIoConfig& config)
+    : filename_(filename), fd_(-1), current_(0), fileOffset_(0), failed_(false) {
+    fd_ = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        throw FileIOException(filename, "open for writing");
+    }
+    ring_ = openRing(config, filename);
+    blocks_.resize(ring_ ? std::max<size_t>(config.depth, 1) : 1);
+    for (Block& block : blocks_) {
+        block.data.resize(std::max<size_t>(config.blockBytes, 1));
+    }
+    setp(blocks_[0].data.data(), blocks_[0].data.data() + blocks_[0].data.size());
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+    sync();
+    if (failed_) {
+        Logger::log("Write failed: " + filename_, LogLevel::ERROR);
+    }
+    ring_.reset();
+    ::close(fd_);
+}
+
+AsyncFileWriter::int_type AsyncFileWriter::overflow(int_type ch) {
+    submitCurrent();
+    if (traits_type::eq_int_type(ch, traits_type::eof())) {
+        return traits_type::not_eof(ch);
+    }
+    *pptr() = traits_type::to_char_type(ch);
+    pbump(1);
+    return ch;
+}
+
+int AsyncFileWriter::sync() {
+    submitCurrent();
+    drain();
+    return failed_ ? -1 : 0;
+}
+
+void AsyncFileWriter::flush() {
+    if (sync() != 0) {
+        throw FileIOException(filename_, "write");
+    }
+}
+
+void AsyncFileWriter::submitCurrent() {
+    Block& block = blocks_[current_];
+    block.length = static_cast<size_t>(pptr() - pbase());
+    if (block.length == 0) return;
+    block.offset = fileOffset_;
+    fileOffset_ += block.length;
+    
+    if (ring_) {
+        block.pending = true;
+        if (!ring_->submit(IORING_OP_WRITE, fd_, block.data.data(), block.length, block.offset, current_)) {
+            block.pending = false;
+            writeSync(block.data.data(), block.length, block.offset);
+        }
+        // Blocs recyclés dans l'ordre : le suivant est le plus ancien soumis
+        current_ = (current_ + 1) % blocks_.size();
+        while (blocks_[current_].pending) {
+            waitCompletion();
+        }
+    } else {
+        writeSync(block.data.data(), block.length, block.offset);
+    }
+    Block& next = blocks_[current_];
+    setp(next.data.data(), next.data.data() + next.data.size());
+}
+
+void AsyncFileWriter::waitCompletion() {
+    uint64_t index;
+    int result;
+    if (!ring_->wait(index, result)) {
+        // Anneau inutilisable : les écritures en vol sont perdues
+        failed_ = true;
+        for (Block& block : blocks_) {
+            block.pending = false;
+        }
+        return;
+    }
+    complete(index, result);
+}
+
+void AsyncFileWriter::complete(uint64_t index, int result) {
+    Block& block = blocks_[index];
+    block.pending = false;
+    if (result < 0) {
+        failed_ = true;
+    } else if (static_cast<size_t>(result) < block.length) {
+        writeSync(block.data.data() + result, block.length - result, block.offset + result);
+    }
+}
+
+void AsyncFileWriter::writeSync(const char* data, size_t length, uint64_t offset) {
+    while (length > 0) {
+        ssize_t n = ::pwrite(fd_, data, length, static_cast<off_t>(offset));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            failed_ = true;
+            return;
+        }
+        data += n;
+        offset += static_cast<uint64_t>(n);
+        length -= static_cast<size_t>(n);
+    }
+}
+
+void AsyncFileWriter::drain() {
+    // Même après une erreur : le noyau lit encore les blocs en vol
+    while (ring_ &&
+           std::any_of(blocks_.begin(), blocks_.end(), [](const Block& b) { return b.pending; })) {
+        waitCompletion();
+    }
+}
@@ -0,0 +1,187 @@
+// ===== src/io/BatchRunner.cpp =====
+#include "io/BatchRunner.hpp"
+#include "utils/ThreadPool.hpp"
+#include "utils/Logger.hpp"
+#include "exceptions/Exceptions.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <set>
+#include <glob.h>
+
+namespace {
+    double throughput(size_t orders, double seconds) {
+        return seconds > 0.0 ? orders / seconds : 0.0;
+    }
+}
+
+size_t BatchReport::getTotalOrders() const {
+    size_t total = 0;
+    for (const auto& entry : entries) total += entry.stats.orderCount;
+    return total;
+}
+
+size_t BatchReport::getTotalEvents() const {
+    size_t total = 0;
+    for (const auto& entry : entries) total += entry.stats.eventCount;
+    return total;
+}
+
+uint64_t BatchReport::getTotalBytes() const {
+    uint64_t total = 0;
+    for (const auto& entry : entries) total += entry.stats.inputBytes;
+    return total;
+}
+
+size_t BatchReport::getFailureCount() const {
+    return std::count_if(entries.begin(), entries.end(),
+                         [](const BatchEntry& entry) { return !entry.error.empty(); });
+}
+
+std::vector<std::string> BatchRunner::expandInputs(const std::vector<std::string>& patterns) {
+    std::set<std::string> files;
+    
+    for (const auto& pattern : patterns) {
+        glob_t matches{};
+        int result = ::glob(pattern.c_str(), 0, nullptr, &matches);
+        if (result == 0) {
+            for (size_t i = 0; i < matches.gl_pathc; ++i) {
+                files.insert(matches.gl_pathv[i]);
+            }
+        }
+        globfree(&matches);
+        
+        if (result == GLOB_NOMATCH) {
+            throw FileIOException(pattern, "match");
+        }
+        if (result != 0) {
+            throw FileIOException(pattern, "glob");
+        }
+    }
+    return {files.begin(), files.end()};
+}
+
+std::string BatchRunner::outputFileFor(const std::string& inputFile, const std::string& outputDir) {
+    std::filesystem::path input(inputFile);
+    return (std::filesystem::path(outputDir) / (input.stem().string() + "_output.csv")).string();
+}
+
+BatchReport BatchRunner::run(const std::vector<std::string>& inputFiles, const BatchOptions& options) {
+    BatchReport report;
+    report.entries.resize(inputFiles.size());
+    
+    // Deux entrées de même nom écriraient dans le même fichier de sortie
+    std::set<std::string> outputs;
+    for (size_t i = 0; i < inputFiles.size(); ++i) {
+        report.entries[i].stats.inputFile = inputFiles[i];
+        report.entries[i].outputFile = outputFileFor(inputFiles[i], options.outputDir);
+        if (!outputs.insert(report.entries[i].outputFile).second) {
+            throw std::invalid_argument("Duplicate input file name: " + inputFiles[i]);
+        }
+    }
+    std::filesystem::create_directories(options.outputDir);
+    
+    // Plus gros fichiers d'abord (la taille est un bon proxy du nombre d'ordres)
+    std::vector<uint64_t> sizes(inputFiles.size());
+    for (size_t i = 0; i < inputFiles.size(); ++i) {
+        std::error_code ec;
+        auto size = std::filesystem::file_size(inputFiles[i], ec);
+        sizes[i] = ec ? 0 : size;
+    }
+    std::vector<size_t> order(inputFiles.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return sizes[a] > sizes[b]; });
+    
+    // Snapshot, journal et export des métriques sont propres à une session unique
+    SessionOptions sessionOptions = options.session;
+    sessionOptions.snapshotIn.clear();
+    sessionOptions.snapshotOut.clear();
+    sessionOptions.journalFile.clear();
+    sessionOptions.recover = false;
+    sessionOptions.metricsTarget.clear();
+    
+    auto startTime = std::chrono::steady_clock::now();
+    {
+        size_t threads = options.threads > 0 ? options.threads : std::thread::hardware_concurrency();
+        // NUMA : un cœur par worker, nœuds alternés ; chaque session alloue
+        // tout son état sur le nœud du worker qui l'exécute
+        ThreadPool pool(std::min(std::max<size_t>(threads, 1), std::max<size_t>(inputFiles.size(), 1)),
+                        options.session.numa ? ThreadPlacement::spread() : ThreadPlacement{});
+        report.threads = pool.size();
+        
+        for (size_t index : order) {
+            BatchEntry& entry = report.entries[index];
+            pool.submit([&entry, &sessionOptions] {
+                try {
+                    entry.stats = Session::run(entry.stats.inputFile, entry.outputFile, sessionOptions);
+                } catch (const std::exception& e) {
+                    entry.error = e.what();
+                    Logger::log("Batch session failed for " + entry.stats.inputFile + ": " + e.what());
+                }
+            });
+        }
+        pool.wait();
+        report.steals = pool.getStealCount();
+    }
+    auto endTime = std::chrono::steady_clock::now();
+    report.wallSeconds = std::chrono::duration<double>(endTime - startTime).count();
+    
+    return report;
+}
+
+void BatchRunner::printReport(const BatchReport& report, std::ostream& out) {
+    out << "=== Batch Backtest Report ===" << std::endl;
+    for (const auto& entry : report.entries) {
+        out << entry.stats.inputFile << ": ";
+        if (!entry.error.empty()) {
+            out << "FAILED (" << entry.error << ")" << std::endl;
+            continue;
+        }
+        out << entry.stats.orderCount << " orders, " << entry.stats.eventCount << " events, "
+            << entry.stats.errorCount << " errors, " << entry.stats.rejectCount << " rejected, "
+            << std::fixed << std::setprecision(3)
+            << entry.stats.seconds << " s, " << std::setprecision(0)
+            << throughput(entry.stats.orderCount, entry.stats.seconds) << " orders/s" << std::endl;
+    }
+    
+    double sessionSeconds = 0.0;
+    for (const auto& entry : report.entries) sessionSeconds += entry.stats.seconds;
+    
+    out << "Files: " << report.entries.size() << " (" << report.getFailureCount() << " failed)" << std::endl;
+    out << "Threads: " << report.threads << " (" << report.steals << " stolen tasks)" << std::endl;
+    out << "Total orders processed: " << report.getTotalOrders() << std::endl;
+    out << "Total events generated: " << report.getTotalEvents() << std::endl;
+    out << "Total input bytes: " << report.getTotalBytes() << std::endl;
+    out << std::setprecision(3);
+    out << "Wall time: " << report.wallSeconds << " seconds" << std::endl;
+    out << "Sum of session times: " << sessionSeconds << " seconds" << std::endl;
+    out << "Speedup: " << (report.wallSeconds > 0.0 ? sessionSeconds / report.wallSeconds : 0.0) << "x" << std::endl;
+    out << std::setprecision(0);
+    out << "Aggregate orders per second: " << throughput(report.getTotalOrders(), report.wallSeconds) << std::endl;
+    out << std::defaultfloat << std::setprecision(6);
+}
+
+void BatchRunner::writeReportCSV(const BatchReport& report, const std::string& filename) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw FileIOException(filename, "open");
+    }
+    
+    file << "input_file,output_file,input_bytes,orders,events,errors,seconds,orders_per_second,status\n";
+    file << std::fixed;
+    for (const auto& entry : report.entries) {
+        file << entry.stats.inputFile << "," << entry.outputFile << "," << entry.stats.inputBytes << ","
+             << entry.stats.orderCount << "," << entry.stats.eventCount << "," << entry.stats.errorCount << ","
+             << std::setprecision(6) << entry.stats.seconds << "," << std::setprecision(0)
+             << throughput(entry.stats.orderCount, entry.stats.seconds) << ","
+             << (entry.error.empty() ? "OK" : "FAILED") << "\n";
+    }
+    file << "TOTAL,," << report.getTotalBytes() << "," << report.getTotalOrders() << ","
+         << report.getTotalEvents() << ",," << std::setprecision(6) << report.wallSeconds << ","
+         << std::setprecision(0) << throughput(report.getTotalOrders(), report.wallSeconds) << ","
+         << (report.getFailureCount() == 0 ? "OK" : "FAILED") << "\n";
+}
@@ -2,35 +2,48 @@
 // ===== src/io/CSVReader.cpp =====
 #include "io/CSVReader.hpp"
 #include "exceptions/Exceptions.hpp"
+#include <cstring>
 #include <sstream>
-#include <fstream>
 #include <stdexcept>
 #include <algorithm>
 
-CSVReader::CSVReader(const std::string& filename, char delim) 
-    : delimiter_(delim), lineNumber_(0) {
-    file_.open(filename);
-    if (!file_.is_open()) {
-        throw FileIOException(filename, "open");
-    }
-    
+CSVReader::CSVReader(const std::string& filename, char delim, const AsyncIoConfig& io) 
+    : file_(filename, io), position_(0), eof_(false), delimiter_(delim), lineNumber_(0) {
     // Skip header
     std::string header;
-    if (std::getline(file_, header)) {
+    if (nextLine(header)) {
         lineNumber_++;
     }
 }
 
-CSVReader::~CSVReader() {
-    if (file_.is_open()) {
-        file_.close();
+CSVReader::~CSVReader() = default;
+
+bool CSVReader::nextLine(std::string& line) {
+    line.clear();
+    while (!eof_) {
+        const char* begin = block_.data() + position_;
+        size_t available = block_.size() - position_;
+        const char* newline = available > 0 ?
+            static_cast<const char*>(std::memchr(begin, '\n', available)) : nullptr;
+        if (newline) {
+            line.append(begin, newline);
+            position_ += static_cast<size_t>(newline - begin) + 1;
+            return true;
+        }
+        // Ligne à cheval sur deux blocs
+        if (available > 0) line.append(begin, available);
+        block_ = file_.next();
+        position_ = 0;
+        eof_ = block_.empty();
     }
+    // Dernière ligne sans fin de ligne
+    return !line.empty();
 }
 
 void CSVReader::readLine(std::function<void(const std::vector<std::string>&)> callback) {
     std::string line;
     
-    while (std::getline(file_, line)) {
+    while (nextLine(line)) {
         lineNumber_++;
         
         if (line.empty()) continue;
@@ -44,8 +57,17 @@ void CSVReader::readLine(std::function<void(const std::vector<std::string>&)> ca
     }
 }
 
+void CSVReader::skip(size_t count) {
+    std::string line;
+    
+    while (count > 0 && nextLine(line)) {
+        lineNumber_++;
+        if (!line.empty()) count--;
+    }
+}
+
 bool CSVReader::hasNext() const {
-    return file_.good() && !file_.eof();
+    return !eof_;
 }
 
 std::vector<std::string> CSVReader::parseLine(const std::string& line) {
@@ -3,18 +3,16 @@
 #include "exceptions/Exceptions.hpp"
 #include <iomanip>
 
-CSVWriter::CSVWriter(const std::string& filename) {
-    file_.open(filename);
-    if (!file_.is_open()) {
-        throw FileIOException(filename, "open for writing");
-    }
+CSVWriter::CSVWriter(const std::string& filename, const AsyncIoConfig& io)
+    : buffer_(filename, io), file_(&buffer_) {
     file_ << std::fixed << std::setprecision(2);
 }
 
-CSVWriter::~CSVWriter() {
-    if (file_.is_open()) {
-        file_.close();
-    }
+CSVWriter::~CSVWriter() = default;
+
+void CSVWriter::flush() {
+    file_.flush();
+    buffer_.flush();
 }
 
 void CSVWriter::writeHeader() {
@@ -45,4 +43,20 @@ void CSVWriter::writeEvent(const OrderEvent& event) {
           << event.executedQuantity << ","
           << event.executionPrice << ","
           << event.counterpartyId << "\n";
-}
\ No newline at end of file
+}
+
+void CSVWriter::writeTradeHeader() {
+    file_ << "timestamp,instrument,buy_order_id,sell_order_id,quantity,price,aggressor_side\n";
+}
+
+void CSVWriter::writeTrade(const Trade& trade) {
+    // Côté agresseur vide pour un fixing d'enchère
+    file_ << trade.timestamp << ","
+          << trade.instrument << ","
+          << trade.buyOrderId << ","
+          << trade.sellOrderId << ","
+          << trade.quantity << ","
+          << trade.price << ","
+          << (trade.aggressorId == 0 ? "" :
+              trade.aggressorId == trade.buyOrderId ? "BUY" : "SELL") << "\n";
+}
@@ -0,0 +1,149 @@
+// ===== src/io/ChunkedCSVReader.cpp =====
+#include "io/ChunkedCSVReader.hpp"
+#include "utils/ThreadPool.hpp"
+#include "exceptions/Exceptions.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+ChunkedCSVReader::ChunkedCSVReader(const std::string& filename, size_t threads,
+                                   size_t chunkBytes, char delim)
+    : filename_(filename), data_(nullptr), size_(0),
+      threads_(std::max<size_t>(threads, 1)), delimiter_(delim), skip_(0),
+      inFlightGauge_(nullptr) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw FileIOException(filename, "open");
+    }
+    
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw FileIOException(filename, "stat");
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    
+    if (size_ > 0) {
+        void* region = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (region == MAP_FAILED) {
+            ::close(fd);
+            throw FileIOException(filename, "mmap");
+        }
+        data_ = static_cast<const char*>(region);
+        madvise(region, size_, MADV_SEQUENTIAL);
+    }
+    ::close(fd);
+    
+    splitChunks(std::max<size_t>(chunkBytes, 1));
+}
+
+ChunkedCSVReader::~ChunkedCSVReader() {
+    if (data_) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+void ChunkedCSVReader::splitChunks(size_t chunkBytes) {
+    // Skip header
+    const char* newline = data_ ? static_cast<const char*>(std::memchr(data_, '\n', size_)) : nullptr;
+    size_t position = newline ? static_cast<size_t>(newline - data_) + 1 : size_;
+    
+    while (position < size_) {
+        size_t end = std::min(position + chunkBytes, size_);
+        // Étendre la tranche jusqu'à la fin de ligne suivante
+        if (end < size_ && data_[end - 1] != '\n') {
+            const char* next = static_cast<const char*>(std::memchr(data_ + end, '\n', size_ - end));
+            end = next ? static_cast<size_t>(next - data_) + 1 : size_;
+        }
+        
+        Chunk chunk;
+        chunk.begin = position;
+        chunk.end = end;
+        chunks_.push_back(std::move(chunk));
+        position = end;
+    }
+}
+
+void ChunkedCSVReader::parseChunk(Chunk& chunk) const {
+    std::vector<std::string> fields;
+    size_t position = chunk.begin;
+    
+    while (position < chunk.end) {
+        const char* newline = static_cast<const char*>(
+            std::memchr(data_ + position, '\n', chunk.end - position));
+        size_t end = newline ? static_cast<size_t>(newline - data_) : chunk.end;
+        std::string_view line(data_ + position, end - position);
+        position = end + 1;
+        chunk.lineCount++;
+        
+        if (line.empty()) continue;
+        
+        splitFields(line, delimiter_, fields);
+        OrderRecord& record = chunk.records.emplace_back();
+        parseOrderRecord(fields, record);
+        record.lineNumber = chunk.lineCount;  // Relatif à la tranche, corrigé à la lecture
+    }
+}
+
+void ChunkedCSVReader::readRecords(std::function<void(const OrderRecord&)> callback) {
+    std::mutex mutex;
+    std::condition_variable chunkReady;
+    
+    // Nombre borné de tranches en vol : la mémoire reste proportionnelle aux threads
+    const size_t window = threads_ * 2;
+    size_t submitted = 0;
+    size_t lineNumber = 1;  // Header
+    
+    ThreadPool pool(threads_, placement_);
+    auto submitNext = [&]() {
+        Chunk& chunk = chunks_[submitted++];
+        pool.submit([this, &chunk, &mutex, &chunkReady] {
+            parseChunk(chunk);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                chunk.ready = true;
+            }
+            chunkReady.notify_all();
+        });
+    };
+    
+    while (submitted < chunks_.size() && submitted < window) {
+        submitNext();
+    }
+    
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+        Chunk& chunk = chunks_[i];
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            chunkReady.wait(lock, [&chunk] { return chunk.ready; });
+        }
+        if (submitted < chunks_.size()) {
+            submitNext();
+        }
+        if (inFlightGauge_) {
+            inFlightGauge_->set(submitted - i);
+        }
+        
+        for (OrderRecord& record : chunk.records) {
+            record.lineNumber += lineNumber;
+            if (skip_ > 0) {
+                skip_--;
+                continue;
+            }
+            try {
+                callback(record);
+            } catch (const std::exception& e) {
+                throw CSVParsingException(record.lineNumber, e.what());
+            }
+        }
+        lineNumber += chunk.lineCount;
+        
+        // Libérer la tranche consommée
+        std::vector<OrderRecord>().swap(chunk.records);
+    }
+}
@@ -0,0 +1,85 @@
+// ===== src/io/JournalReader.cpp =====
+#include "io/JournalReader.hpp"
+#include "io/JournalFormat.hpp"
+#include "exceptions/Exceptions.hpp"
+#include <fstream>
+#include <vector>
+#include <unistd.h>
+
+JournalRecovery JournalReader::recover(const std::string& filename, InstrumentManager& manager,
+                                       uint64_t afterInputSequence) {
+    JournalRecovery result;
+    
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw FileIOException(filename, "open");
+    }
+    
+    // Lecture par blocs d'enregistrements entiers
+    std::vector<JournalRecord> chunk(4096);
+    bool done = false;
+    
+    while (!done) {
+        file.read(reinterpret_cast<char*>(chunk.data()), chunk.size() * sizeof(JournalRecord));
+        size_t bytes = static_cast<size_t>(file.gcount());
+        size_t count = bytes / sizeof(JournalRecord);
+        
+        if (bytes % sizeof(JournalRecord) != 0) {
+            result.tornTail = true;  // Dernier enregistrement écrit à moitié
+        }
+        
+        for (size_t i = 0; i < count; ++i) {
+            const JournalRecord& r = chunk[i];
+            if (r.checksum != journalChecksum(r) || r.sequence != result.records ||
+                r.symbolLength > kJournalSymbolSize) {
+                result.tornTail = true;
+                done = true;
+                break;
+            }
+            
+            result.records++;
+            result.lastInputSequence = r.inputSequence;
+            if (afterInputSequence > 0 && r.inputSequence <= afterInputSequence) {
+                continue;  // Déjà couvert par le snapshot
+            }
+            
+            try {
+                std::string symbol(r.symbol, r.symbolLength);
+                if (static_cast<Action>(r.action) == Action::MASS_CANCEL) {
+                    MassCancelFilter filter;
+                    filter.allSides = r.allSides != 0;
+                    filter.side = static_cast<Side>(r.side);
+                    filter.owner = r.owner;
+                    filter.priceBound = r.price;
+                    manager.massCancel(r.timestamp, r.orderId, symbol, filter);
+                    result.applied++;
+                    continue;
+                }
+                
+                OrderOptions options;
+                options.owner = r.owner;
+                options.selfTradePrevention = static_cast<SelfTradePrevention>(r.selfTradePrevention);
+                options.timeInForce = static_cast<TimeInForce>(r.timeInForce);
+                options.displayQuantity = r.displayQuantity;
+                options.stopPrice = r.stopPrice;
+                manager.processOrder(r.timestamp, r.orderId, symbol,
+                                     static_cast<Side>(r.side), static_cast<OrderType>(r.type),
+                                     r.quantity, r.price, static_cast<Action>(r.action), options);
+            } catch (const std::exception&) {
+                result.errors++;
+            }
+            result.applied++;
+        }
+        
+        if (!file) done = true;
+    }
+    file.close();
+    
+    // Supprimer la fin invalide pour que le journal puisse être complété
+    if (result.tornTail &&
+        ::truncate(filename.c_str(), static_cast<off_t>(result.records * sizeof(JournalRecord))) != 0) {
+        throw FileIOException(filename, "truncate");
+    }
+    
+    return result;
+}
@@ -0,0 +1,168 @@
+// ===== src/io/JournalWriter.cpp =====
+#include "io/JournalWriter.hpp"
+#include "exceptions/Exceptions.hpp"
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+JournalWriter::JournalWriter(const std::string& filename, const JournalConfig& config,
+                             uint64_t startSequence)
+    : filename_(filename), config_(config), fd_(-1), ring_(config.ringCapacity),
+      nextSequence_(startSequence), inputSequence_(0), stalls_(0),
+      durableSequence_(startSequence), commits_(0), flushRequested_(false),
+      failed_(false), running_(true) {
+    
+    if (config_.groupCommitRecords == 0) config_.groupCommitRecords = 1;
+    
+    int flags = O_WRONLY | O_CREAT | O_APPEND | (startSequence == 0 ? O_TRUNC : 0);
+    fd_ = ::open(filename.c_str(), flags, 0644);
+    if (fd_ < 0) {
+        throw FileIOException(filename, "open for writing");
+    }
+    
+    thread_ = std::thread(&JournalWriter::run, this);
+}
+
+JournalWriter::~JournalWriter() {
+    running_.store(false, std::memory_order_release);
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+void JournalWriter::append(Timestamp timestamp, OrderId id, std::string_view instrument,
+                           Side side, OrderType type, Quantity quantity, Price price,
+                           Action action, const OrderOptions& options) {
+    JournalRecord record = makeRecord(timestamp, id, instrument, action);
+    record.quantity = quantity;
+    record.price = price;
+    record.side = static_cast<uint8_t>(side);
+    record.type = static_cast<uint8_t>(type);
+    record.owner = options.owner;
+    record.selfTradePrevention = static_cast<uint8_t>(options.selfTradePrevention);
+    record.timeInForce = static_cast<uint8_t>(options.timeInForce);
+    record.displayQuantity = options.displayQuantity;
+    record.stopPrice = options.stopPrice;
+    push(record);
+}
+
+void JournalWriter::appendMassCancel(Timestamp timestamp, OrderId id, std::string_view instrument,
+                                     const MassCancelFilter& filter) {
+    JournalRecord record = makeRecord(timestamp, id, instrument, Action::MASS_CANCEL);
+    record.price = filter.priceBound;
+    record.side = static_cast<uint8_t>(filter.side);
+    record.allSides = filter.allSides ? 1 : 0;
+    record.owner = filter.owner;
+    push(record);
+}
+
+JournalRecord JournalWriter::makeRecord(Timestamp timestamp, OrderId id, std::string_view instrument,
+                                        Action action) {
+    if (failed_.load(std::memory_order_relaxed)) {
+        throw FileIOException(filename_, "journal write");
+    }
+    if (instrument.size() > kJournalSymbolSize) {
+        throw FileIOException(filename_, "journal append (instrument name too long)");
+    }
+    
+    JournalRecord record{};
+    record.sequence = nextSequence_;
+    record.inputSequence = inputSequence_;
+    record.timestamp = timestamp;
+    record.orderId = id;
+    record.action = static_cast<uint8_t>(action);
+    record.symbolLength = static_cast<uint8_t>(instrument.size());
+    std::memcpy(record.symbol, instrument.data(), instrument.size());
+    return record;
+}
+
+void JournalWriter::push(JournalRecord& record) {
+    record.checksum = journalChecksum(record);
+    
+    // File pleine : le thread de fond est en retard sur le disque (backpressure)
+    while (!ring_.tryPush(record)) {
+        stalls_++;
+        std::this_thread::yield();
+    }
+    nextSequence_++;
+}
+
+void JournalWriter::flush() {
+    flushRequested_.store(true, std::memory_order_release);
+    while (durableSequence_.load(std::memory_order_acquire) < nextSequence_ &&
+           !failed_.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+    flushRequested_.store(false, std::memory_order_release);
+    if (failed_.load(std::memory_order_acquire)) {
+        throw FileIOException(filename_, "journal write");
+    }
+}
+
+void JournalWriter::run() {
+    using Clock = std::chrono::steady_clock;
+    const auto maxDelay = std::chrono::microseconds(config_.groupCommitMicros);
+    const auto idleSleep = std::chrono::microseconds(
+        std::max<uint64_t>(1, std::min<uint64_t>(config_.groupCommitMicros / 4, 50)));
+    
+    std::vector<JournalRecord> batch;
+    batch.reserve(config_.groupCommitRecords);
+    Clock::time_point firstPending;
+    
+    while (true) {
+        bool stopping = !running_.load(std::memory_order_acquire);
+        
+        JournalRecord record;
+        bool received = false;
+        while (batch.size() < config_.groupCommitRecords && ring_.tryPop(record)) {
+            if (batch.empty()) firstPending = Clock::now();
+            batch.push_back(record);
+            received = true;
+        }
+        
+        if (!batch.empty() &&
+            (batch.size() >= config_.groupCommitRecords || stopping ||
+             flushRequested_.load(std::memory_order_acquire) ||
+             Clock::now() - firstPending >= maxDelay)) {
+            commit(batch.data(), batch.size());
+            batch.clear();
+            continue;
+        }
+        
+        if (stopping && ring_.empty()) break;
+        if (!received) std::this_thread::sleep_for(idleSleep);
+    }
+}
+
+void JournalWriter::commit(const JournalRecord* records, size_t count) {
+    // Après une erreur, les lots suivants sont écartés : rien n'est déclaré durable
+    if (failed_.load(std::memory_order_relaxed)) return;
+    
+    const char* data = reinterpret_cast<const char*>(records);
+    size_t remaining = count * sizeof(JournalRecord);
+    while (remaining > 0) {
+        ssize_t written = ::write(fd_, data, remaining);
+        if (written < 0 && errno == EINTR) continue;
+        if (written < 0) {
+            failed_.store(true, std::memory_order_release);
+            return;
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+    }
+    int synced;
+    while ((synced = ::fdatasync(fd_)) != 0 && errno == EINTR) {}
+    if (synced != 0) {
+        failed_.store(true, std::memory_order_release);
+        return;
+    }
+    
+    commits_.fetch_add(1, std::memory_order_relaxed);
+    durableSequence_.store(records[count - 1].sequence + 1, std::memory_order_release);
+}
@@ -0,0 +1,183 @@
+// ===== src/io/MetricsExporter.cpp =====
+#include "io/MetricsExporter.hpp"
+#include "core/InstrumentManager.hpp"
+#include "exceptions/Exceptions.hpp"
+#include "utils/Logger.hpp"
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace {
+    constexpr const char* kUnixPrefix = "unix:";
+    constexpr const char* kActionNames[] = {"NEW", "MODIFY", "CANCEL", "MASS_CANCEL"};
+    
+    void header(std::ostringstream& out, const char* name, const char* type, const char* help) {
+        out << "# HELP " << name << " " << help << "\n"
+            << "# TYPE " << name << " " << type << "\n";
+    }
+}
+
+MetricsExporter::MetricsExporter(const std::string& target, uint64_t intervalMillis,
+                                 const InstrumentManager& manager, const PipelineMetrics& pipeline)
+    : manager_(manager), pipeline_(pipeline), target_(target),
+      intervalMillis_(intervalMillis > 0 ? intervalMillis : 1), listenFd_(-1), stopping_(false) {
+    
+    if (target_.rfind(kUnixPrefix, 0) == 0) {
+        std::string path = target_.substr(std::strlen(kUnixPrefix));
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+            throw FileIOException(path, "metrics socket (invalid path)");
+        }
+        std::memcpy(address.sun_path, path.c_str(), path.size());
+        ::unlink(path.c_str());
+        
+        listenFd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (listenFd_ < 0 ||
+            ::bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+            ::listen(listenFd_, 8) != 0) {
+            if (listenFd_ >= 0) ::close(listenFd_);
+            throw FileIOException(path, "metrics socket");
+        }
+    }
+    
+    thread_ = std::thread(&MetricsExporter::run, this);
+}
+
+MetricsExporter::~MetricsExporter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    stopRequested_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    if (listenFd_ >= 0) {
+        ::close(listenFd_);
+        ::unlink(target_.c_str() + std::strlen(kUnixPrefix));
+    }
+}
+
+void MetricsExporter::run() {
+    if (listenFd_ < 0) {
+        // Fichier : réécriture périodique, puis état final à l'arrêt
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stopping_) {
+            lock.unlock();
+            writeFile();
+            lock.lock();
+            stopRequested_.wait_for(lock, std::chrono::milliseconds(intervalMillis_),
+                                    [this] { return stopping_; });
+        }
+        lock.unlock();
+        writeFile();
+        return;
+    }
+    
+    // Socket : une exposition complète par connexion
+    const int pollMillis = static_cast<int>(std::min<uint64_t>(intervalMillis_, 100));
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stopping_) break;
+        }
+        pollfd fd{listenFd_, POLLIN, 0};
+        if (::poll(&fd, 1, pollMillis) <= 0) continue;
+        
+        int client = ::accept4(listenFd_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client < 0) continue;
+        std::string text = render(manager_, pipeline_);
+        for (size_t sent = 0; sent < text.size();) {
+            ssize_t n = ::send(client, text.data() + sent, text.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0) break;
+            sent += static_cast<size_t>(n);
+        }
+        ::close(client);
+    }
+}
+
+void MetricsExporter::writeFile() const {
+    // Réécriture atomique : un lecteur ne voit jamais un fichier partiel
+    std::string tmpName = target_ + ".tmp";
+    {
+        std::ofstream file(tmpName, std::ios::trunc);
+        file << render(manager_, pipeline_);
+        if (!file) {
+            Logger::log("Metrics export failed: " + tmpName, LogLevel::WARNING);
+            return;
+        }
+    }
+    if (std::rename(tmpName.c_str(), target_.c_str()) != 0) {
+        Logger::log("Metrics export failed: " + target_, LogLevel::WARNING);
+    }
+}
+
+std::string MetricsExporter::render(const InstrumentManager& manager, const PipelineMetrics& pipeline) {
+    std::ostringstream out;
+    
+    header(out, "matching_engine_orders_total", "counter", "Order actions received, by instrument and action.");
+    manager.forEachMetrics([&](std::string_view instrument, const EngineMetrics& metrics) {
+        for (size_t action = 0; action < metrics.ordersByAction.size(); ++action) {
+            out << "matching_engine_orders_total{instrument=\"" << instrument << "\",action=\""
+                << kActionNames[action] << "\"} " << metrics.ordersByAction[action].get() << "\n";
+        }
+    });
+    
+    // Une série par instrument pour chaque compteur ou jauge simple
+    auto perInstrument = [&](const char* name, const char* type, const char* help,
+                             const MetricCounter EngineMetrics::*member) {
+        header(out, name, type, help);
+        manager.forEachMetrics([&](std::string_view instrument, const EngineMetrics& metrics) {
+            out << name << "{instrument=\"" << instrument << "\"} " << (metrics.*member).get() << "\n";
+        });
+    };
+    perInstrument("matching_engine_fills_total", "counter", "Fills (trades) executed.", &EngineMetrics::fills);
+    perInstrument("matching_engine_rejects_total", "counter", "Actions rejected by the engine.",
+                  &EngineMetrics::rejects);
+    perInstrument("matching_engine_events_total", "counter", "Order events emitted.",
+                  &EngineMetrics::eventsEmitted);
+    perInstrument("matching_engine_resting_orders", "gauge", "Orders resting in the book.",
+                  &EngineMetrics::restingOrders);
+    perInstrument("matching_engine_order_history_size", "gauge", "Orders kept in the order history.",
+                  &EngineMetrics::historySize);
+    
+    header(out, "matching_engine_price_levels", "gauge", "Price levels per book side.");
+    manager.forEachMetrics([&](std::string_view instrument, const EngineMetrics& metrics) {
+        out << "matching_engine_price_levels{instrument=\"" << instrument << "\",side=\"BUY\"} "
+            << metrics.bidLevels.get() << "\n"
+            << "matching_engine_price_levels{instrument=\"" << instrument << "\",side=\"SELL\"} "
+            << metrics.askLevels.get() << "\n";
+    });
+    
+    header(out, "matching_engine_input_lines_total", "counter", "Input lines handed to the engine.");
+    out << "matching_engine_input_lines_total " << pipeline.inputLines.get() << "\n";
+    header(out, "matching_engine_parse_chunks_in_flight", "gauge", "Input chunks submitted for parsing and not yet consumed.");
+    out << "matching_engine_parse_chunks_in_flight " << pipeline.parseChunksInFlight.get() << "\n";
+    header(out, "matching_engine_journal_pending", "gauge", "Journal records waiting for the writer thread.");
+    out << "matching_engine_journal_pending " << pipeline.journalPending.get() << "\n";
+    header(out, "matching_engine_journal_stalls_total", "counter", "Appends that waited on a full journal queue.");
+    out << "matching_engine_journal_stalls_total " << pipeline.journalStalls.get() << "\n";
+    header(out, "matching_engine_log_records_dropped_total", "counter", "Log records dropped on a full logger queue.");
+    out << "matching_engine_log_records_dropped_total " << Logger::getDroppedCount() << "\n";
+    
+    // Histogramme cumulatif, bornes en secondes
+    const LatencyHistogram& latency = pipeline.processLatency;
+    header(out, "matching_engine_process_latency_seconds", "histogram", "Engine processing time per input line.");
+    uint64_t cumulative = 0;
+    for (size_t bucket = 0; bucket < LatencyHistogram::kBuckets - 1; ++bucket) {
+        cumulative += latency.getBucket(bucket);
+        out << "matching_engine_process_latency_seconds_bucket{le=\""
+            << static_cast<double>(LatencyHistogram::upperBound(bucket)) * 1e-9 << "\"} " << cumulative << "\n";
+    }
+    out << "matching_engine_process_latency_seconds_bucket{le=\"+Inf\"} " << latency.getCount() << "\n"
+        << "matching_engine_process_latency_seconds_sum " << static_cast<double>(latency.getSumNanos()) * 1e-9 << "\n"
+        << "matching_engine_process_latency_seconds_count " << latency.getCount() << "\n";
+    
+    return out.str();
+}
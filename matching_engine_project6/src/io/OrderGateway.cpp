@@ -0,0 +1,322 @@
+// ===== src/io/OrderGateway.cpp =====
+#include "io/OrderGateway.hpp"
+#include "core/InstrumentManager.hpp"
+#include "exceptions/Exceptions.hpp"
+#include "utils/Logger.hpp"
+#include "utils/TimeUtils.hpp"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace {
+    constexpr const char* kUnixPrefix = "unix:";
+    constexpr const char* kTcpPrefix = "tcp:";
+    constexpr int kMaxEpollEvents = 64;
+    constexpr int kMaxReadsPerWake = 16;  // Équité entre connexions (epoll en mode niveau)
+    
+    // Valeurs d'énumérations hors bornes ou symbole vide : message invalide
+    bool isValidOrder(const GatewayOrder& message) {
+        return message.side <= static_cast<uint8_t>(Side::SELL) &&
+               message.type <= static_cast<uint8_t>(OrderType::MARKET) &&
+               message.action <= static_cast<uint8_t>(Action::MASS_CANCEL) &&
+               message.timeInForce <= static_cast<uint8_t>(TimeInForce::DAY) &&
+               message.selfTradePrevention <= static_cast<uint8_t>(SelfTradePrevention::DECREMENT_AND_CANCEL) &&
+               message.symbolLength > 0 && message.symbolLength <= kGatewaySymbolSize;
+    }
+}
+
+OrderGateway::OrderGateway(InstrumentManager& manager, const GatewayConfig& config)
+    : manager_(manager), config_(config), listenFd_(-1), epollFd_(-1), wakeFd_(-1), port_(0),
+      readBuffer_(std::max<size_t>(config.recvBytes, sizeof(GatewayOrder))) {
+    
+    const std::string& endpoint = config_.endpoint;
+    if (endpoint.rfind(kUnixPrefix, 0) == 0) {
+        unixPath_ = endpoint.substr(std::strlen(kUnixPrefix));
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (unixPath_.empty() || unixPath_.size() >= sizeof(address.sun_path)) {
+            throw FileIOException(endpoint, "gateway endpoint");
+        }
+        std::memcpy(address.sun_path, unixPath_.c_str(), unixPath_.size());
+        ::unlink(unixPath_.c_str());
+        listenFd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (listenFd_ < 0 || ::bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            if (listenFd_ >= 0) ::close(listenFd_);
+            throw FileIOException(endpoint, "gateway bind");
+        }
+    } else if (endpoint.rfind(kTcpPrefix, 0) == 0) {
+        // Boucle locale uniquement : le protocole n'est ni authentifié ni portable
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(static_cast<uint16_t>(std::stoul(endpoint.substr(std::strlen(kTcpPrefix)))));
+        listenFd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        int reuse = 1;
+        if (listenFd_ >= 0) ::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        if (listenFd_ < 0 || ::bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            if (listenFd_ >= 0) ::close(listenFd_);
+            throw FileIOException(endpoint, "gateway bind");
+        }
+        socklen_t length = sizeof(address);
+        ::getsockname(listenFd_, reinterpret_cast<sockaddr*>(&address), &length);
+        port_ = ntohs(address.sin_port);
+    } else {
+        throw FileIOException(endpoint, "gateway endpoint (expected unix:<path> or tcp:<port>)");
+    }
+    
+    epollFd_ = ::epoll_create1(EPOLL_CLOEXEC);
+    wakeFd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (::listen(listenFd_, SOMAXCONN) != 0 || epollFd_ < 0 || wakeFd_ < 0) {
+        throw FileIOException(endpoint, "gateway listen");
+    }
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = listenFd_;
+    ::epoll_ctl(epollFd_, EPOLL_CTL_ADD, listenFd_, &event);
+    event.data.fd = wakeFd_;
+    ::epoll_ctl(epollFd_, EPOLL_CTL_ADD, wakeFd_, &event);
+}
+
+OrderGateway::~OrderGateway() {
+    while (!connections_.empty()) {
+        close(connections_.begin()->first);
+    }
+    if (listenFd_ >= 0) ::close(listenFd_);
+    if (epollFd_ >= 0) ::close(epollFd_);
+    if (wakeFd_ >= 0) ::close(wakeFd_);
+    if (!unixPath_.empty()) ::unlink(unixPath_.c_str());
+}
+
+void OrderGateway::stop() {
+    uint64_t one = 1;
+    [[maybe_unused]] ssize_t written = ::write(wakeFd_, &one, sizeof(one));
+}
+
+void OrderGateway::run() {
+    epoll_event events[kMaxEpollEvents];
+    bool stopping = false;
+    
+    while (!stopping) {
+        int count = ::epoll_wait(epollFd_, events, kMaxEpollEvents, -1);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            throw FileIOException(config_.endpoint, "gateway epoll_wait");
+        }
+        
+        for (int i = 0; i < count; ++i) {
+            int fd = events[i].data.fd;
+            if (fd == wakeFd_) {
+                stopping = true;
+                continue;
+            }
+            if (fd == listenFd_) {
+                accept();
+                continue;
+            }
+            
+            auto it = connections_.find(fd);
+            if (it == connections_.end()) continue;  // Fermée plus tôt dans ce lot
+            uint32_t flags = events[i].events;
+            if (flags & EPOLLOUT) {
+                flush(it->second);
+                it = connections_.find(fd);
+                if (it == connections_.end()) continue;
+            }
+            if (flags & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                readConnection(it->second);
+            }
+        }
+        
+        // Un envoi par connexion pour tout le lot
+        flushDirty();
+    }
+}
+
+void OrderGateway::accept() {
+    while (true) {
+        int fd = ::accept4(listenFd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) return;  // EAGAIN : plus de connexion en attente
+        
+        if (unixPath_.empty()) {
+            int noDelay = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+        }
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        ::epoll_ctl(epollFd_, EPOLL_CTL_ADD, fd, &event);
+        connections_[fd].fd = fd;
+        stats_.connections++;
+    }
+}
+
+bool OrderGateway::readConnection(Connection& connection) {
+    for (int reads = 0; reads < kMaxReadsPerWake; ++reads) {
+        ssize_t received = ::recv(connection.fd, readBuffer_.data(), readBuffer_.size(), 0);
+        if (received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+            close(connection.fd);
+            return false;
+        }
+        if (received < 0) {
+            if (errno == EINTR) continue;
+            return true;  // Tout ce qui était disponible a été lu
+        }
+        
+        std::vector<char>& input = connection.input;
+        input.insert(input.end(), readBuffer_.data(), readBuffer_.data() + received);
+        
+        // Messages complets du tampon, le reste attend la lecture suivante
+        size_t offset = 0;
+        while (input.size() - offset >= sizeof(GatewayHeader)) {
+            GatewayHeader header;
+            std::memcpy(&header, input.data() + offset, sizeof(header));
+            bool isOrder = header.type == static_cast<uint8_t>(GatewayMessageType::ORDER) &&
+                           header.length == sizeof(GatewayOrder);
+            bool isSubscribe = header.type == static_cast<uint8_t>(GatewayMessageType::SUBSCRIBE) &&
+                               header.length == sizeof(GatewaySubscribe);
+            if (header.version != kGatewayProtocolVersion || (!isOrder && !isSubscribe)) {
+                stats_.protocolErrors++;
+                Logger::log("Gateway protocol error, closing connection", LogLevel::WARNING);
+                close(connection.fd);
+                return false;
+            }
+            if (input.size() - offset < header.length) break;
+            
+            if (isOrder) {
+                GatewayOrder message;
+                std::memcpy(&message, input.data() + offset, sizeof(message));
+                if (!handleOrder(connection, message)) {
+                    close(connection.fd);
+                    return false;
+                }
+            } else if (!connection.subscriber) {
+                connection.subscriber = true;
+                subscribers_.push_back(connection.fd);
+            }
+            offset += header.length;
+        }
+        input.erase(input.begin(), input.begin() + static_cast<std::ptrdiff_t>(offset));
+    }
+    return true;  // Reste lu au prochain réveil
+}
+
+bool OrderGateway::handleOrder(Connection& connection, const GatewayOrder& message) {
+    if (!isValidOrder(message)) {
+        stats_.protocolErrors++;
+        Logger::log("Gateway protocol error: invalid order fields", LogLevel::WARNING);
+        return false;
+    }
+    stats_.messages++;
+    
+    std::string instrument(message.symbol, message.symbolLength);
+    OrderOptions options;
+    options.owner = message.owner;
+    options.selfTradePrevention = static_cast<SelfTradePrevention>(message.selfTradePrevention);
+    options.timeInForce = static_cast<TimeInForce>(message.timeInForce);
+    options.displayQuantity = message.displayQuantity;
+    options.stopPrice = message.stopPrice;
+    Timestamp timestamp = message.timestamp != 0 ? message.timestamp : getCurrentTimestamp();
+    
+    MatchingEngine& engine = manager_.getOrCreateEngine(instrument);
+    try {
+        manager_.processOrder(timestamp, message.orderId, instrument, static_cast<Side>(message.side),
+                              static_cast<OrderType>(message.type), message.quantity, message.price,
+                              static_cast<Action>(message.action), options);
+    } catch (const std::exception& e) {
+        Logger::log("Error processing order: " + std::string(e.what()), LogLevel::ERROR);
+    }
+    
+    // Événements de l'action : à l'émetteur et aux abonnés drop copy
+    GatewayEvent encoded;
+    for (const OrderEvent& event : engine.getEvents()) {
+        encodeGatewayEvent(encoded, event);
+        queue(connection, &encoded, sizeof(encoded));
+        for (int subscriber : subscribers_) {
+            if (subscriber != connection.fd) {
+                queue(connections_[subscriber], &encoded, sizeof(encoded));
+            }
+        }
+    }
+    stats_.events += engine.getEvents().size();
+    engine.discardEvents();
+    return true;
+}
+
+void OrderGateway::queue(Connection& connection, const void* data, size_t size) {
+    size_t pending = connection.output.size() - connection.outputOffset;
+    if (pending == 0 && !connection.waitingWritable) {
+        dirty_.push_back(connection.fd);
+    } else if (connection.waitingWritable && pending <= config_.maxPendingBytes &&
+               pending + size > config_.maxPendingBytes) {
+        // Seuil franchi en attendant EPOLLOUT : revérifié en fin de lot
+        dirty_.push_back(connection.fd);
+    }
+    const char* bytes = static_cast<const char*>(data);
+    connection.output.insert(connection.output.end(), bytes, bytes + size);
+}
+
+void OrderGateway::flush(Connection& connection) {
+    while (connection.outputOffset < connection.output.size()) {
+        ssize_t sent = ::send(connection.fd, connection.output.data() + connection.outputOffset,
+                              connection.output.size() - connection.outputOffset, MSG_NOSIGNAL);
+        if (sent > 0) {
+            connection.outputOffset += static_cast<size_t>(sent);
+            continue;
+        }
+        if (sent < 0 && errno == EINTR) continue;
+        if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            // Client trop lent : fermé plutôt que de retenir la mémoire sans limite
+            if (connection.output.size() - connection.outputOffset > config_.maxPendingBytes) {
+                stats_.slowConsumers++;
+                Logger::log("Gateway slow consumer disconnected", LogLevel::WARNING);
+                close(connection.fd);
+                return;
+            }
+            if (!connection.waitingWritable) {
+                epoll_event event{};
+                event.events = EPOLLIN | EPOLLOUT;
+                event.data.fd = connection.fd;
+                ::epoll_ctl(epollFd_, EPOLL_CTL_MOD, connection.fd, &event);
+                connection.waitingWritable = true;
+            }
+            return;
+        }
+        close(connection.fd);
+        return;
+    }
+    
+    connection.output.clear();
+    connection.outputOffset = 0;
+    if (connection.waitingWritable) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = connection.fd;
+        ::epoll_ctl(epollFd_, EPOLL_CTL_MOD, connection.fd, &event);
+        connection.waitingWritable = false;
+    }
+}
+
+void OrderGateway::flushDirty() {
+    for (int fd : dirty_) {
+        auto it = connections_.find(fd);
+        if (it != connections_.end()) {
+            flush(it->second);
+        }
+    }
+    dirty_.clear();
+}
+
+void OrderGateway::close(int fd) {
+    ::epoll_ctl(epollFd_, EPOLL_CTL_DEL, fd, nullptr);
+    ::close(fd);
+    connections_.erase(fd);
+    subscribers_.erase(std::remove(subscribers_.begin(), subscribers_.end(), fd), subscribers_.end());
+}
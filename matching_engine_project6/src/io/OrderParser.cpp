@@ -0,0 +1,170 @@
+// ===== src/io/OrderParser.cpp =====
+#include "io/OrderParser.hpp"
+#include <stdexcept>
+
+Side parseSide(const std::string& str) {
+    if (str == "BUY") return Side::BUY;
+    if (str == "SELL") return Side::SELL;
+    throw std::invalid_argument("Invalid side: " + str);
+}
+
+OrderType parseOrderType(const std::string& str) {
+    if (str == "LIMIT") return OrderType::LIMIT;
+    if (str == "MARKET") return OrderType::MARKET;
+    throw std::invalid_argument("Invalid order type: " + str);
+}
+
+Action parseAction(const std::string& str) {
+    if (str == "NEW") return Action::NEW;
+    if (str == "MODIFY") return Action::MODIFY;
+    if (str == "CANCEL") return Action::CANCEL;
+    if (str == "MASS_CANCEL") return Action::MASS_CANCEL;
+    throw std::invalid_argument("Invalid action: " + str);
+}
+
+SelfTradePrevention parseSelfTradePrevention(const std::string& str) {
+    if (str.empty() || str == "NONE") return SelfTradePrevention::NONE;
+    if (str == "CANCEL_NEWEST") return SelfTradePrevention::CANCEL_NEWEST;
+    if (str == "CANCEL_OLDEST") return SelfTradePrevention::CANCEL_OLDEST;
+    if (str == "CANCEL_BOTH") return SelfTradePrevention::CANCEL_BOTH;
+    if (str == "DECREMENT_AND_CANCEL") return SelfTradePrevention::DECREMENT_AND_CANCEL;
+    throw std::invalid_argument("Invalid self-trade prevention: " + str);
+}
+
+TimeInForce parseTimeInForce(const std::string& str) {
+    if (str.empty() || str == "GTC") return TimeInForce::GTC;
+    if (str == "IOC") return TimeInForce::IOC;
+    if (str == "FOK") return TimeInForce::FOK;
+    if (str == "DAY") return TimeInForce::DAY;
+    throw std::invalid_argument("Invalid time in force: " + str);
+}
+
+AllocationPolicy parseAllocationPolicy(const std::string& str) {
+    if (str == "FIFO") return AllocationPolicy::FIFO;
+    if (str == "PRO_RATA") return AllocationPolicy::PRO_RATA;
+    if (str == "TOP_PRO_RATA") return AllocationPolicy::TOP_PRO_RATA;
+    throw std::invalid_argument("Invalid allocation policy: " + str);
+}
+
+EventMode parseEventMode(const std::string& str) {
+    if (str == "FULL") return EventMode::FULL;
+    if (str == "AGGREGATED") return EventMode::AGGREGATED;
+    if (str == "TRADES") return EventMode::TRADES;
+    throw std::invalid_argument("Invalid event mode: " + str);
+}
+
+// Fonction pour parser le prix avec gestion spéciale des ordres MARKET
+Price parsePrice(const std::string& str, OrderType type) {
+    // Pour les ordres MARKET, toujours retourner 0 peu importe la valeur
+    if (type == OrderType::MARKET) {
+        return 0.0;
+    }
+    
+    // Pour les ordres LIMIT, parser normalement
+    try {
+        if (str.empty() || str == "na" || str == "NA" || str == "null" || str == "NULL") {
+            throw std::invalid_argument("Invalid price for LIMIT order");
+        }
+        return std::stod(str);
+    } catch (...) {
+        throw std::invalid_argument("Invalid price: " + str);
+    }
+}
+
+void splitFields(std::string_view line, char delimiter, std::vector<std::string>& fields) {
+    size_t count = 0;
+    size_t start = 0;
+    
+    while (start < line.size()) {
+        size_t end = line.find(delimiter, start);
+        if (end == std::string_view::npos) end = line.size();
+        
+        // Trim whitespace
+        std::string_view field = line.substr(start, end - start);
+        size_t first = field.find_first_not_of(" \t");
+        size_t last = field.find_last_not_of(" \t");
+        field = first == std::string_view::npos ? std::string_view() : field.substr(first, last - first + 1);
+        
+        // Réutilise les chaînes déjà allouées d'une ligne à l'autre
+        if (count < fields.size()) {
+            fields[count].assign(field.data(), field.size());
+        } else {
+            fields.emplace_back(field);
+        }
+        count++;
+        start = end + 1;
+    }
+    fields.resize(count);
+}
+
+namespace {
+    // MASS_CANCEL : côté vide ou "*" = les deux côtés, prix vide ou 0 = sans
+    // borne, propriétaire facultatif ; type et quantité sont ignorés
+    void parseMassCancel(const std::vector<std::string>& fields, OrderRecord& record) {
+        MassCancelFilter& filter = record.massCancel;
+        filter = MassCancelFilter{};
+        if (!fields[3].empty() && fields[3] != "*") {
+            filter.allSides = false;
+            filter.side = parseSide(fields[3]);
+            record.side = filter.side;
+        }
+        if (!fields[6].empty()) {
+            filter.priceBound = std::stod(fields[6]);
+        }
+        if (fields.size() > 8 && !fields[8].empty()) {
+            filter.owner = std::stoull(fields[8]);
+        }
+        record.options = OrderOptions{};
+        record.options.owner = filter.owner;
+        record.quantity = 0;
+        record.price = filter.priceBound;
+    }
+}
+
+void parseOrderRecord(const std::vector<std::string>& fields, OrderRecord& record) {
+    if (fields.size() < 8) {
+        record.status = OrderRecord::Status::INSUFFICIENT_FIELDS;
+        return;
+    }
+    
+    try {
+        record.timestamp = std::stoull(fields[0]);
+        record.orderId = std::stoull(fields[1]);
+        record.instrument = fields[2];
+        if (fields[7] == "MASS_CANCEL") {
+            record.action = Action::MASS_CANCEL;
+            parseMassCancel(fields, record);
+            record.status = OrderRecord::Status::VALID;
+            return;
+        }
+        record.side = parseSide(fields[3]);
+        record.type = parseOrderType(fields[4]);
+        record.quantity = std::stoull(fields[5]);
+        // Utiliser la fonction parsePrice qui gère les ordres MARKET
+        record.price = parsePrice(fields[6], record.type);
+        record.action = parseAction(fields[7]);
+        
+        // Colonnes facultatives : propriétaire, prévention d'auto-exécution,
+        // validité, quantité affichée (iceberg), prix de déclenchement (stop)
+        record.options = OrderOptions{};
+        if (fields.size() > 8 && !fields[8].empty()) {
+            record.options.owner = std::stoull(fields[8]);
+        }
+        if (fields.size() > 9) {
+            record.options.selfTradePrevention = parseSelfTradePrevention(fields[9]);
+        }
+        if (fields.size() > 10) {
+            record.options.timeInForce = parseTimeInForce(fields[10]);
+        }
+        if (fields.size() > 11 && !fields[11].empty()) {
+            record.options.displayQuantity = std::stoull(fields[11]);
+        }
+        if (fields.size() > 12 && !fields[12].empty()) {
+            record.options.stopPrice = std::stod(fields[12]);
+        }
+        record.status = OrderRecord::Status::VALID;
+    } catch (const std::exception& e) {
+        record.status = OrderRecord::Status::PARSE_ERROR;
+        record.error = e.what();
+    }
+}
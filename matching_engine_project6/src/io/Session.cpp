@@ -0,0 +1,318 @@
+// ===== src/io/Session.cpp =====
+#include "io/Session.hpp"
+#include "io/CSVReader.hpp"
+#include "io/ChunkedCSVReader.hpp"
+#include "io/CSVWriter.hpp"
+#include "io/OrderParser.hpp"
+#include "io/SnapshotReader.hpp"
+#include "io/SnapshotWriter.hpp"
+#include "io/JournalReader.hpp"
+#include "io/MetricsExporter.hpp"
+#include "core/InstrumentManager.hpp"
+#include "utils/Logger.hpp"
+#include "utils/HugePageArena.hpp"
+#include "utils/NumaTopology.hpp"
+#include "utils/ThreadPool.hpp"
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+
+SessionStats Session::run(const std::string& inputFile, const std::string& outputFile,
+                          const SessionOptions& options) {
+    // Un rejeu en continu des ordres reçus pendant une enchère donnerait un
+    // autre carnet que celui de la session interrompue
+    if ((options.recover || !options.snapshotIn.empty()) &&
+        (options.openingAuctionEnd > 0 || options.closingAuctionStart > 0)) {
+        throw std::invalid_argument("Recovery (--recover, --snapshot-in) cannot be combined with "
+                                    "--opening-auction or --closing-auction");
+    }
+    
+    SessionStats stats;
+    stats.inputFile = inputFile;
+    
+    // Mesurer le temps de traitement
+    auto startTime = std::chrono::high_resolution_clock::now();
+    
+    // Placement NUMA : le thread appelant reste sur son nœud, où sont faites
+    // les allocations qui suivent (carnets, pools d'ordres, index, événements)
+    int numaNode = -1;
+    int numaCpu = -1;
+    if (options.numa) {
+        numaNode = NumaTopology::get().pinToCurrentNode(numaCpu);
+    }
+    const ThreadPlacement helperPlacement =
+        numaNode >= 0 ? ThreadPlacement::onNode(numaNode) : ThreadPlacement{};
+    
+    // Mode pré-allocation : arène pré-touchée + pool pour réutiliser les blocs libérés
+    const CapacityConfig& capacity = options.capacity;
+    std::unique_ptr<HugePageArena> arena;
+    std::unique_ptr<std::pmr::unsynchronized_pool_resource> pool;
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource();
+    
+    if (capacity.isEnabled()) {
+        arena = std::make_unique<HugePageArena>(
+            InstrumentManager::estimateArenaBytes(capacity), capacity.useHugePages,
+            std::pmr::new_delete_resource(), numaNode);
+        pool = std::make_unique<std::pmr::unsynchronized_pool_resource>(arena.get());
+        resource = pool.get();
+        Logger::log("Pre-allocated arena: " + std::to_string(arena->getCapacity()) +
+                    " bytes (" + HugePageArena::backingName(arena->getBacking()) + ")");
+    }
+    
+    // Initialiser les composants
+    InstrumentManager manager(resource);
+    if (capacity.isEnabled()) {
+        manager.reserve(capacity);
+    }
+    manager.setRiskLimits(options.riskLimits);
+    manager.setEventMode(options.eventMode);
+    std::unique_ptr<CSVReader> reader;
+    std::unique_ptr<ChunkedCSVReader> chunkedReader;
+    if (options.parseThreads > 0) {
+        chunkedReader = std::make_unique<ChunkedCSVReader>(inputFile, options.parseThreads);
+        chunkedReader->setPlacement(helperPlacement);
+    } else {
+        reader = std::make_unique<CSVReader>(inputFile, ',', options.io);
+    }
+    CSVWriter writer(outputFile, options.io);
+    if (options.io.backend == IoBackend::URING) {
+        Logger::log(std::string("CSV I/O backend: ") + ioBackendName(writer.getBackend()));
+    }
+    stats.inputBytes = std::filesystem::file_size(inputFile);
+    
+    const bool tradesOnly = options.eventMode == EventMode::TRADES;
+    if (tradesOnly) {
+        writer.writeTradeHeader();
+    } else {
+        writer.writeHeader();
+    }
+    
+    size_t orderCount = 0;
+    size_t errorCount = 0;
+    size_t rejectCount = 0;
+    uint64_t sequence = 0;  // Lignes d'entrée déjà appliquées
+    
+    // Reprise : restaurer les carnets puis ne rejouer que la fin du fichier
+    if (!options.snapshotIn.empty()) {
+        SnapshotReader snapshot(options.snapshotIn);
+        sequence = snapshot.restore(manager);
+        Logger::log("Restored snapshot " + options.snapshotIn + ": " +
+                    std::to_string(snapshot.header().orderCount) + " orders, resuming at line " +
+                    std::to_string(sequence));
+    }
+    
+    // Reprise sur journal : rejouer les actions postérieures au snapshot
+    std::unique_ptr<JournalWriter> journal;
+    uint64_t journalRecords = 0;
+    if (options.recover && !options.journalFile.empty()) {
+        JournalRecovery recovery = JournalReader::recover(options.journalFile, manager, sequence);
+        journalRecords = recovery.records;
+        sequence = std::max<uint64_t>(sequence, recovery.lastInputSequence);
+        Logger::log("Recovered journal " + options.journalFile + ": " + std::to_string(recovery.applied) +
+                    " actions replayed" + (recovery.tornTail ? ", torn tail truncated" : ""));
+    }
+    if (!options.journalFile.empty()) {
+        journal = std::make_unique<JournalWriter>(options.journalFile, options.journalConfig,
+                                                  journalRecords);
+        manager.setJournal(journal.get());
+    }
+    
+    for (const auto& [instrument, policy] : options.allocationPolicies) {
+        manager.setAllocationPolicy(instrument, policy);
+    }
+    for (const auto& [instrument, band] : options.priceBands) {
+        manager.setPriceBand(instrument, band);
+    }
+    
+    const uint64_t startSequence = sequence;
+    
+    // Métriques : le thread de matching écrit, l'exporteur lit. Déclaré après
+    // le manager pour être détruit (dernier export) avant lui.
+    const bool metricsEnabled = !options.metricsTarget.empty();
+    PipelineMetrics pipelineMetrics;
+    std::unique_ptr<MetricsExporter> metricsExporter;
+    if (metricsEnabled) {
+        metricsExporter = std::make_unique<MetricsExporter>(
+            options.metricsTarget, options.metricsIntervalMillis, manager, pipelineMetrics);
+        if (chunkedReader) {
+            chunkedReader->setInFlightGauge(&pipelineMetrics.parseChunksInFlight);
+        }
+    }
+    auto publishPipeline = [&]() {
+        if (journal) {
+            pipelineMetrics.journalPending.set(journal->getPendingCount());
+            pipelineMetrics.journalStalls.set(journal->getStallCount());
+        }
+    };
+    
+    // Enchères : le fixing parallèle réutilise un pool créé au premier besoin
+    std::unique_ptr<ThreadPool> auctionPool;
+    bool openingAuction = options.openingAuctionEnd > 0;
+    bool closingAuction = false;
+    Timestamp lastTimestamp = 0;
+    auto uncross = [&](Timestamp timestamp) {
+        if (options.auctionThreads > 1 && !auctionPool) {
+            auctionPool = std::make_unique<ThreadPool>(options.auctionThreads, helperPlacement);
+        }
+        Quantity volume = manager.uncrossAll(timestamp, auctionPool.get());
+        Logger::write(LogFormat::AUCTION_UNCROSS, timestamp, volume);
+    };
+    if (openingAuction) {
+        manager.startAuction();
+    }
+    
+    // Traiter chaque ligne du fichier
+    auto processRecord = [&](const OrderRecord& record) {
+        // Snapshot périodique de l'état après les `sequence` premières lignes
+        if (options.snapshotEvery > 0 && !options.snapshotOut.empty() &&
+            sequence > startSequence && sequence % options.snapshotEvery == 0) {
+            SnapshotWriter::write(options.snapshotOut, manager, sequence);
+        }
+        sequence++;
+        if (journal) journal->setInputSequence(sequence);
+        
+        if (record.status == OrderRecord::Status::INSUFFICIENT_FIELDS) {
+            errorCount++;
+            Logger::write<LogLevel::WARNING>(LogFormat::LINE_INVALID, record.lineNumber);
+            return;
+        }
+        if (record.status == OrderRecord::Status::PARSE_ERROR) {
+            errorCount++;
+            Logger::log("Error processing order: " + record.error, LogLevel::WARNING);
+            return;
+        }
+        
+        // Changements de phase déclenchés par le premier ordre qui franchit l'heure
+        if (openingAuction && record.timestamp >= options.openingAuctionEnd) {
+            uncross(options.openingAuctionEnd);
+            openingAuction = false;
+        }
+        if (options.closingAuctionStart > 0 && !closingAuction && !openingAuction &&
+            record.timestamp >= options.closingAuctionStart) {
+            manager.startAuction();
+            closingAuction = true;
+        }
+        lastTimestamp = std::max(lastTimestamp, record.timestamp);
+        
+        // Latence mesurée seulement si l'export est actif
+        std::chrono::steady_clock::time_point processStart;
+        if (metricsEnabled) {
+            processStart = std::chrono::steady_clock::now();
+        }
+        
+        try {
+            // Traiter l'ordre
+            if (record.action == Action::MASS_CANCEL) {
+                manager.massCancel(record.timestamp, record.orderId, record.instrument,
+                                   record.massCancel);
+            } else {
+                OrderRejection rejection = manager.processOrder(
+                    record.timestamp, record.orderId, record.instrument, record.side, record.type,
+                    record.quantity, record.price, record.action, record.options);
+                if (rejection != OrderRejection::NONE) {
+                    rejectCount++;
+                    Logger::write(LogFormat::ORDER_REJECTED, record.orderId,
+                                  static_cast<uint8_t>(rejection));
+                }
+            }
+            
+            orderCount++;
+            
+            if (metricsEnabled) {
+                pipelineMetrics.processLatency.record(static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - processStart).count()));
+                pipelineMetrics.inputLines.set(sequence);
+                if ((orderCount & 1023) == 0) {
+                    publishPipeline();
+                }
+            }
+            
+            // Log périodique
+            if (orderCount % 10000 == 0) {
+                Logger::write(LogFormat::ORDERS_PROCESSED, orderCount);
+            }
+            
+        } catch (const std::exception& e) {
+            errorCount++;
+            Logger::log("Error processing order: " + std::string(e.what()), LogLevel::ERROR);
+        }
+    };
+    
+    // Thread de matching fixé sur son cœur ; les threads créés avant (journal,
+    // export) gardent l'affinité du nœud
+    if (numaNode >= 0) {
+        NumaTopology::pinCurrentThread({numaCpu});
+    }
+    
+    if (chunkedReader) {
+        chunkedReader->skip(sequence);
+        chunkedReader->readRecords(processRecord);
+    } else {
+        reader->skip(sequence);
+        OrderRecord record;
+        reader->readLine([&](const std::vector<std::string>& fields) {
+            parseOrderRecord(fields, record);
+            processRecord(record);
+        });
+    }
+    
+    // Enchère encore ouverte en fin d'entrée
+    if (manager.isInAuction()) {
+        uncross(openingAuction ? options.openingAuctionEnd : lastTimestamp);
+    }
+    manager.endHalts();
+    
+    if (journal) {
+        journal->flush();
+        manager.setJournal(nullptr);
+    }
+    if (metricsEnabled) {
+        pipelineMetrics.inputLines.set(sequence);
+        publishPipeline();
+    }
+    
+    if (!options.snapshotOut.empty()) {
+        SnapshotWriter::write(options.snapshotOut, manager, sequence);
+        Logger::log("Snapshot written to " + options.snapshotOut + " at line " + std::to_string(sequence));
+    }
+    
+    // La session couvre la journée : les ordres DAY restants expirent
+    manager.expireDayOrders();
+    
+    // Écrire tous les événements (ou tous les trades) dans le fichier de sortie
+    size_t eventCount = 0;
+    if (tradesOnly) {
+        auto allTrades = manager.getAllTrades();
+        for (const auto& trade : allTrades) {
+            writer.writeTrade(trade);
+        }
+        eventCount = allTrades.size();
+    } else {
+        auto allEvents = manager.getAllEvents();
+        for (const auto& event : allEvents) {
+            writer.writeEvent(event);
+        }
+        eventCount = allEvents.size();
+    }
+    writer.flush();
+    
+    auto endTime = std::chrono::high_resolution_clock::now();
+    
+    stats.orderCount = orderCount;
+    stats.errorCount = errorCount;
+    stats.rejectCount = rejectCount;
+    stats.eventCount = eventCount;
+    stats.seconds = std::chrono::duration<double>(endTime - startTime).count();
+    stats.numaNode = numaNode;
+    if (arena) {
+        stats.hasArena = true;
+        stats.arenaBacking = HugePageArena::backingName(arena->getBacking());
+        stats.arenaUsed = arena->getUsed();
+        stats.arenaCapacity = arena->getCapacity();
+        stats.arenaOverflow = arena->getOverflowAllocations();
+    }
+    return stats;
+}
@@ -0,0 +1,113 @@
+// ===== src/io/SnapshotReader.cpp =====
+#include "io/SnapshotReader.hpp"
+#include "exceptions/Exceptions.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+
+SnapshotReader::SnapshotReader(const std::string& filename)
+    : filename_(filename), data_(nullptr), size_(0) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw FileIOException(filename, "open");
+    }
+    
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(SnapshotHeader)) {
+        ::close(fd);
+        throw FileIOException(filename, "snapshot read (truncated header)");
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    
+    void* region = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+    ::close(fd);
+    if (region == MAP_FAILED) {
+        throw FileIOException(filename, "mmap");
+    }
+    data_ = static_cast<const char*>(region);
+    
+    const SnapshotHeader& h = header();
+    size_t expected = sizeof(SnapshotHeader)
+                    + h.instrumentCount * sizeof(SnapshotInstrument)
+                    + h.orderCount * sizeof(SnapshotOrder)
+                    + h.positionCount * sizeof(SnapshotPosition);
+    if (std::memcmp(h.magic, kSnapshotMagic, sizeof(h.magic)) != 0 ||
+        h.version != kSnapshotVersion || expected != size_) {
+        munmap(const_cast<char*>(data_), size_);
+        data_ = nullptr;
+        throw FileIOException(filename, "snapshot read (invalid format)");
+    }
+}
+
+SnapshotReader::~SnapshotReader() {
+    if (data_) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+const SnapshotHeader& SnapshotReader::header() const {
+    return *reinterpret_cast<const SnapshotHeader*>(data_);
+}
+
+const SnapshotInstrument* SnapshotReader::instruments() const {
+    return reinterpret_cast<const SnapshotInstrument*>(data_ + sizeof(SnapshotHeader));
+}
+
+const SnapshotOrder* SnapshotReader::orders() const {
+    return reinterpret_cast<const SnapshotOrder*>(
+        data_ + sizeof(SnapshotHeader) + header().instrumentCount * sizeof(SnapshotInstrument));
+}
+
+const SnapshotPosition* SnapshotReader::positions() const {
+    return reinterpret_cast<const SnapshotPosition*>(orders() + header().orderCount);
+}
+
+uint64_t SnapshotReader::restore(InstrumentManager& manager) const {
+    const SnapshotHeader& h = header();
+    const SnapshotInstrument* table = instruments();
+    const SnapshotOrder* records = orders();
+    const SnapshotPosition* accounts = positions();
+    
+    for (uint32_t i = 0; i < h.instrumentCount; ++i) {
+        const SnapshotInstrument& entry = table[i];
+        if (entry.firstOrder + entry.orderCount > h.orderCount ||
+            entry.restingCount > entry.orderCount ||
+            entry.firstPosition + entry.positionCount > h.positionCount) {
+            throw FileIOException(filename_, "snapshot read (order range out of bounds)");
+        }
+        
+        std::string symbol(entry.symbol, strnlen(entry.symbol, kSnapshotSymbolSize));
+        MatchingEngine& engine = manager.getOrCreateEngine(symbol);
+        engine.reserve(entry.orderCount);
+        engine.restoreLastTradePrice(entry.lastTradePrice);
+        for (uint64_t j = 0; j < entry.positionCount; ++j) {
+            const SnapshotPosition& p = accounts[entry.firstPosition + j];
+            engine.restorePosition(p.owner, p.position);
+        }
+        
+        // Les ordres au repos sont stockés en priorité prix-temps : les réinsérer
+        // dans cet ordre reconstruit chaque file de niveau à l'identique.
+        // Les ordres terminés ne retournent que dans l'historique.
+        for (uint64_t j = 0; j < entry.orderCount; ++j) {
+            const SnapshotOrder& r = records[entry.firstOrder + j];
+            OrderOptions options;
+            options.owner = r.owner;
+            options.selfTradePrevention = static_cast<SelfTradePrevention>(r.selfTradePrevention);
+            options.timeInForce = static_cast<TimeInForce>(r.timeInForce);
+            options.displayQuantity = r.displayQuantity;
+            options.stopPrice = r.stopPrice;
+            engine.restoreOrder(r.timestamp, r.orderId, static_cast<Side>(r.side),
+                                static_cast<OrderType>(r.type), r.quantity, r.price,
+                                r.remainingQuantity, r.executedQuantity, r.executionPrice,
+                                r.counterpartyId, static_cast<OrderStatus>(r.status), options,
+                                r.visibleQuantity);
+        }
+        // Après les ordres : une suspension en cours reprend avec son carnet
+        // accumulé et son fixing à l'échéance
+        engine.restorePhase(static_cast<TradingPhase>(entry.phase), entry.haltEnd);
+    }
+    
+    return h.sequence;
+}
@@ -0,0 +1,110 @@
+// ===== src/io/SnapshotWriter.cpp =====
+#include "io/SnapshotWriter.hpp"
+#include "io/SnapshotFormat.hpp"
+#include "exceptions/Exceptions.hpp"
+#include <fstream>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    SnapshotOrder toRecord(const Order& order) {
+        SnapshotOrder record{};
+        record.timestamp = order.getTimestamp();
+        record.orderId = order.getOrderId();
+        record.quantity = order.getQuantity();
+        record.remainingQuantity = order.getRemainingQuantity();
+        record.executedQuantity = order.getExecutedQuantity();
+        record.price = order.getPrice();
+        record.executionPrice = order.getExecutionPrice();
+        record.counterpartyId = order.getCounterpartyId();
+        record.side = static_cast<uint8_t>(order.getSide());
+        record.type = static_cast<uint8_t>(order.getType());
+        record.status = static_cast<uint8_t>(order.getStatus());
+        record.owner = order.getOwner();
+        record.selfTradePrevention = static_cast<uint8_t>(order.getSelfTradePrevention());
+        record.timeInForce = static_cast<uint8_t>(order.getTimeInForce());
+        record.displayQuantity = order.getOptions().displayQuantity;
+        record.visibleQuantity = order.getVisibleQuantity();
+        record.stopPrice = order.getStopPrice();
+        return record;
+    }
+    
+    template<typename BookSideType>
+    void appendSide(const BookSideType& side, std::vector<SnapshotOrder>& out) {
+        for (const auto& [price, level] : side) {
+            for (size_t slot = level.beginSlot(); slot < level.endSlot(); ++slot) {
+                const OrderPtr& order = level.orderAt(slot);
+                if (order) out.push_back(toRecord(*order));
+            }
+        }
+    }
+}
+
+void SnapshotWriter::write(const std::string& filename, const InstrumentManager& manager,
+                           uint64_t sequence) {
+    std::vector<SnapshotInstrument> instruments;
+    std::vector<SnapshotOrder> orders;
+    std::vector<SnapshotPosition> positions;
+    instruments.reserve(manager.getEngineCount());
+    
+    manager.forEachEngine([&](const std::string& symbol, const MatchingEngine& engine) {
+        if (symbol.size() >= kSnapshotSymbolSize) {
+            throw FileIOException(filename, "snapshot (instrument name too long: " + symbol + ")");
+        }
+        
+        const OrderBook& book = engine.getOrderBook();
+        SnapshotInstrument entry{};
+        std::memcpy(entry.symbol, symbol.data(), symbol.size());
+        entry.firstOrder = orders.size();
+        appendSide(book.getBids(), orders);
+        appendSide(book.getAsks(), orders);
+        book.getStops().forEach([&](const OrderPtr& order) { orders.push_back(toRecord(*order)); });
+        entry.lastTradePrice = book.getLastTradePrice();
+        entry.phase = static_cast<uint8_t>(engine.getPhase());
+        entry.haltEnd = engine.getHaltEnd();
+        entry.restingCount = orders.size() - entry.firstOrder;
+        
+        for (const auto& [id, order] : engine.getOrderHistory()) {
+            if (!order->isActive()) orders.push_back(toRecord(*order));
+        }
+        entry.orderCount = orders.size() - entry.firstOrder;
+        
+        entry.firstPosition = positions.size();
+        engine.getRisk().forEachAccount([&](OwnerId owner, const AccountExposure& exposure) {
+            if (exposure.position != 0) positions.push_back({owner, exposure.position});
+        });
+        entry.positionCount = positions.size() - entry.firstPosition;
+        instruments.push_back(entry);
+    });
+    
+    SnapshotHeader header{};
+    std::memcpy(header.magic, kSnapshotMagic, sizeof(header.magic));
+    header.version = kSnapshotVersion;
+    header.instrumentCount = static_cast<uint32_t>(instruments.size());
+    header.sequence = sequence;
+    header.orderCount = orders.size();
+    header.positionCount = positions.size();
+    
+    std::string tmpName = filename + ".tmp";
+    {
+        std::ofstream file(tmpName, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            throw FileIOException(tmpName, "open for writing");
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(instruments.data()),
+                   instruments.size() * sizeof(SnapshotInstrument));
+        file.write(reinterpret_cast<const char*>(orders.data()),
+                   orders.size() * sizeof(SnapshotOrder));
+        file.write(reinterpret_cast<const char*>(positions.data()),
+                   positions.size() * sizeof(SnapshotPosition));
+        if (!file) {
+            throw FileIOException(tmpName, "write");
+        }
+    }
+    
+    if (std::rename(tmpName.c_str(), filename.c_str()) != 0) {
+        throw FileIOException(filename, "rename");
+    }
+}
@@ -0,0 +1,110 @@
+// ===== src/utils/HugePageArena.cpp =====
+#include "utils/HugePageArena.hpp"
+#include "utils/NumaTopology.hpp"
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstdint>
+
+namespace {
+    constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+    
+    size_t roundUp(size_t value, size_t multiple) {
+        return (value + multiple - 1) / multiple * multiple;
+    }
+}
+
+HugePageArena::HugePageArena(size_t capacity, bool useHugePages,
+                             std::pmr::memory_resource* upstream, int numaNode)
+    : base_(nullptr), capacity_(0), used_(0), overflowAllocations_(0),
+      backing_(Backing::NONE), upstream_(upstream) {
+    
+    if (capacity == 0) return;
+    
+    void* region = MAP_FAILED;
+    
+#ifdef MAP_HUGETLB
+    if (useHugePages) {
+        size_t size = roundUp(capacity, kHugePageSize);
+        region = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (region != MAP_FAILED) {
+            capacity_ = size;
+            backing_ = Backing::HUGETLB;
+        }
+    }
+#endif
+    
+    if (region == MAP_FAILED) {
+        // Repli : pages normales, alignées sur 2 Mo pour laisser THP les fusionner
+        size_t size = roundUp(capacity, useHugePages ? kHugePageSize : 4096);
+        region = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (region == MAP_FAILED) return;
+        
+        capacity_ = size;
+        backing_ = Backing::REGULAR_PAGES;
+#ifdef MADV_HUGEPAGE
+        if (useHugePages && madvise(region, size, MADV_HUGEPAGE) == 0) {
+            backing_ = Backing::TRANSPARENT_HUGE_PAGES;
+        }
+#endif
+    }
+    
+    base_ = static_cast<std::byte*>(region);
+    if (numaNode >= 0) {
+        NumaTopology::bindMemory(base_, capacity_, numaNode);
+    }
+    prefault();
+}
+
+HugePageArena::~HugePageArena() {
+    if (base_) {
+        munmap(base_, capacity_);
+    }
+}
+
+const char* HugePageArena::backingName(Backing backing) {
+    switch (backing) {
+        case Backing::HUGETLB: return "hugetlb";
+        case Backing::TRANSPARENT_HUGE_PAGES: return "transparent-huge-pages";
+        case Backing::REGULAR_PAGES: return "regular-pages";
+        case Backing::NONE: break;
+    }
+    return "none";
+}
+
+void HugePageArena::prefault() {
+    // Toucher chaque page maintenant plutôt qu'au premier ordre de la journée
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    volatile std::byte* p = base_;
+    for (size_t offset = 0; offset < capacity_; offset += pageSize) {
+        p[offset] = std::byte{0};
+    }
+}
+
+void* HugePageArena::do_allocate(size_t bytes, size_t alignment) {
+    if (base_) {
+        uintptr_t current = reinterpret_cast<uintptr_t>(base_) + used_;
+        uintptr_t aligned = (current + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        size_t newUsed = (aligned - reinterpret_cast<uintptr_t>(base_)) + bytes;
+        if (newUsed <= capacity_) {
+            used_ = newUsed;
+            return reinterpret_cast<void*>(aligned);
+        }
+    }
+    
+    overflowAllocations_++;
+    return upstream_->allocate(bytes, alignment);
+}
+
+void HugePageArena::do_deallocate(void* p, size_t bytes, size_t alignment) {
+    auto* ptr = static_cast<std::byte*>(p);
+    if (base_ && ptr >= base_ && ptr < base_ + capacity_) {
+        return;  // Monotone : la région est libérée d'un bloc à la destruction
+    }
+    upstream_->deallocate(p, bytes, alignment);
+}
+
+bool HugePageArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
@@ -1,32 +1,171 @@
-
 // ===== src/utils/Logger.cpp =====
 #include "utils/Logger.hpp"
+#include <ctime>
 
 std::ofstream Logger::logFile_;
-bool Logger::enabled_ = false;
+std::atomic<bool> Logger::enabled_{false};
+std::atomic<bool> Logger::running_{false};
+std::atomic<uint64_t> Logger::dropped_{0};
+std::thread Logger::thread_;
+std::mutex Logger::mutex_;
+std::vector<std::shared_ptr<Logger::Ring>> Logger::rings_;
+std::atomic<size_t> Logger::ringCount_{0};
+
+namespace {
+    const char* formatString(LogFormat format) {
+        switch (format) {
+            case LogFormat::ORDERS_PROCESSED: return "Processed {} orders";
+            case LogFormat::ORDER_REJECTED:   return "Order {} rejected (reason {})";
+            case LogFormat::LINE_INVALID:     return "Invalid line format: insufficient fields (line {})";
+            case LogFormat::AUCTION_UNCROSS:  return "Auction uncross at {}: {} executed";
+            default:                          return "{}";
+        }
+    }
+    
+    const char* levelName(LogLevel level) {
+        switch (level) {
+            case LogLevel::DEBUG:   return "DEBUG";
+            case LogLevel::INFO:    return "INFO";
+            case LogLevel::WARNING: return "WARNING";
+            default:                return "ERROR";
+        }
+    }
+}
 
 void Logger::init(const std::string& filename) {
+    close();
+    
+    std::lock_guard<std::mutex> lock(mutex_);
+    logFile_.open(filename, std::ios::app);
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread(&Logger::run);
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+Logger::Ring& Logger::threadRing() {
+    // File créée au premier message du thread ; le registre la garde en vie
+    // après la fin du thread pour que le thread de fond la vide
+    thread_local std::shared_ptr<Ring> ring = [] {
+        auto created = std::make_shared<Ring>(kRingCapacity);
+        std::lock_guard<std::mutex> lock(mutex_);
+        rings_.push_back(created);
+        ringCount_.store(rings_.size(), std::memory_order_release);
+        return created;
+    }();
+    return *ring;
+}
+
+void Logger::push(LogRecord& record) {
+    if (!threadRing().tryPush(record)) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        delete record.text;
+    }
+}
+
+void Logger::log(const std::string& message, LogLevel level) {
+    if (level < kMinLogLevel || !enabled_.load(std::memory_order_relaxed)) return;
+    
+    LogRecord record{};
+    record.wallNanos = now();
+    record.format = LogFormat::TEXT;
+    record.level = level;
+    record.text = new std::string(message);
+    push(record);
+}
+
+void Logger::close() {
+    enabled_.store(false, std::memory_order_relaxed);
+    running_.store(false, std::memory_order_release);
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    
+    std::lock_guard<std::mutex> lock(mutex_);
     if (logFile_.is_open()) {
         logFile_.close();
     }
-    logFile_.open(filename, std::ios::app);
-    enabled_ = true;
 }
 
-void Logger::log(const std::string& message) {
-    if (!enabled_) return;
+void Logger::run() {
+    std::vector<std::shared_ptr<Ring>> rings;
     
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
+    while (true) {
+        bool stopping = !running_.load(std::memory_order_acquire);
+        
+        // Nouvelles files enregistrées depuis le dernier passage
+        if (ringCount_.load(std::memory_order_acquire) != rings.size()) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            rings = rings_;
+        }
+        
+        size_t written = drain(rings);
+        if (stopping) break;  // Dernier passage complet après l'arrêt
+        if (written == 0) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                logFile_.flush();
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
     
-    if (logFile_.is_open()) {
-        logFile_ << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S")
-                 << " - " << message << std::endl;
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+    if (dropped > 0 && logFile_.is_open()) {
+        logFile_ << dropped << " log records dropped (ring full)\n";
     }
+    logFile_.flush();
 }
 
-void Logger::close() {
-    if (logFile_.is_open()) {
-        logFile_.close();
+size_t Logger::drain(std::vector<std::shared_ptr<Ring>>& rings) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t written = 0;
+    LogRecord record;
+    for (auto& ring : rings) {
+        while (ring->tryPop(record)) {
+            format(record);
+            written++;
+        }
     }
-}
\ No newline at end of file
+    return written;
+}
+
+void Logger::format(const LogRecord& record) {
+    std::unique_ptr<std::string> text(record.text);
+    if (!logFile_.is_open()) return;
+    
+    std::time_t seconds = static_cast<std::time_t>(record.wallNanos / 1'000'000'000);
+    std::tm local{};
+    localtime_r(&seconds, &local);
+    char stamp[32];
+    std::strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", &local);
+    logFile_ << stamp << " " << levelName(record.level) << " - ";
+    
+    if (record.format == LogFormat::TEXT) {
+        logFile_ << (text ? *text : std::string()) << '\n';
+        return;
+    }
+    
+    // Remplacement des '{}' par les arguments dans l'ordre
+    size_t arg = 0;
+    for (const char* c = formatString(record.format); *c; ++c) {
+        if (c[0] == '{' && c[1] == '}' && arg < record.argCount) {
+            uint64_t bits = record.args[arg];
+            switch ((record.argKinds >> (2 * arg)) & 3) {
+                case 1: logFile_ << static_cast<int64_t>(bits); break;
+                case 2: {
+                    double value;
+                    std::memcpy(&value, &bits, sizeof(value));
+                    logFile_ << value;
+                    break;
+                }
+                default: logFile_ << bits; break;
+            }
+            arg++;
+            ++c;
+        } else {
+            logFile_ << *c;
+        }
+    }
+    logFile_ << '\n';
+}
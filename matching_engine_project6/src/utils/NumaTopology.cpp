@@ -0,0 +1,199 @@
+// ===== src/utils/NumaTopology.cpp =====
+#include "utils/NumaTopology.hpp"
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace {
+    constexpr int kMaxNodes = 1024;
+    // set_mempolicy / mbind attendent le nombre de bits du masque plus un
+    constexpr unsigned long kMaskBits = kMaxNodes + 1;
+    constexpr size_t kMaskWords = kMaxNodes / (8 * sizeof(unsigned long));
+    
+    std::string readFirstLine(const std::string& path) {
+        std::ifstream file(path);
+        std::string line;
+        std::getline(file, line);
+        return line;
+    }
+    
+    // Masque ne contenant que `node`
+    bool nodeMask(int node, unsigned long (&mask)[kMaskWords]) {
+        if (node < 0 || node >= kMaxNodes) return false;
+        std::fill(std::begin(mask), std::end(mask), 0UL);
+        mask[node / (8 * sizeof(unsigned long))] |= 1UL << (node % (8 * sizeof(unsigned long)));
+        return true;
+    }
+}
+
+NumaTopology::NumaTopology(const std::string& sysfsRoot, std::vector<int> allowed) {
+    std::sort(allowed.begin(), allowed.end());
+    
+    for (int id : parseCpuList(readFirstLine(sysfsRoot + "/online"))) {
+        std::string directory = sysfsRoot + "/node" + std::to_string(id);
+        if (!std::filesystem::exists(directory)) continue;
+        
+        NumaNode node;
+        node.id = id;
+        for (int cpu : parseCpuList(readFirstLine(directory + "/cpulist"))) {
+            if (allowed.empty() || std::binary_search(allowed.begin(), allowed.end(), cpu)) {
+                node.cpus.push_back(cpu);
+            }
+        }
+        // "Node 0 MemTotal:       16318196 kB"
+        std::ifstream meminfo(directory + "/meminfo");
+        std::string line;
+        while (std::getline(meminfo, line)) {
+            size_t position = line.find("MemTotal:");
+            if (position != std::string::npos) {
+                node.memoryBytes = std::stoull(line.substr(position + 9)) * 1024;
+                break;
+            }
+        }
+        std::istringstream distances(readFirstLine(directory + "/distance"));
+        for (int distance; distances >> distance;) {
+            node.distances.push_back(distance);
+        }
+        nodes_.push_back(std::move(node));
+    }
+    
+    // Pas de sysfs NUMA : un nœud unique
+    if (nodes_.empty()) {
+        NumaNode node;
+        node.cpus = allowed;
+        if (node.cpus.empty()) {
+            for (unsigned cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); ++cpu) {
+                node.cpus.push_back(static_cast<int>(cpu));
+            }
+        }
+        node.distances.push_back(10);
+        nodes_.push_back(std::move(node));
+    }
+    
+    for (size_t rank = 0;; ++rank) {
+        bool any = false;
+        for (const NumaNode& node : nodes_) {
+            if (rank < node.cpus.size()) {
+                spreadCpus_.push_back(node.cpus[rank]);
+                any = true;
+            }
+        }
+        if (!any) break;
+    }
+}
+
+const NumaTopology& NumaTopology::get() {
+    static const NumaTopology topology;
+    return topology;
+}
+
+const NumaNode* NumaTopology::findNode(int id) const {
+    for (const NumaNode& node : nodes_) {
+        if (node.id == id) return &node;
+    }
+    return nullptr;
+}
+
+int NumaTopology::nodeOfCpu(int cpu) const {
+    for (const NumaNode& node : nodes_) {
+        if (std::find(node.cpus.begin(), node.cpus.end(), cpu) != node.cpus.end()) return node.id;
+    }
+    return -1;
+}
+
+int NumaTopology::cpuForWorker(size_t index) const {
+    return spreadCpus_.empty() ? -1 : spreadCpus_[index % spreadCpus_.size()];
+}
+
+void NumaTopology::report(std::ostream& out) const {
+    out << "=== NUMA Topology ===" << std::endl;
+    out << "Nodes: " << nodes_.size() << std::endl;
+    for (const NumaNode& node : nodes_) {
+        out << "Node " << node.id << ": " << node.cpus.size() << " CPUs (";
+        for (size_t i = 0; i < node.cpus.size(); ++i) {
+            // Plages consécutives regroupées : 0-7,16-23
+            size_t last = i;
+            while (last + 1 < node.cpus.size() && node.cpus[last + 1] == node.cpus[last] + 1) last++;
+            out << (i > 0 ? "," : "") << node.cpus[i];
+            if (last > i) out << "-" << node.cpus[last];
+            i = last;
+        }
+        out << "), memory " << (node.memoryBytes >> 20) << " MB, distances";
+        for (int distance : node.distances) {
+            out << " " << distance;
+        }
+        out << std::endl;
+    }
+}
+
+int NumaTopology::pinToCurrentNode(int& cpu) const {
+    cpu = currentCpu();
+    const NumaNode* node = findNode(nodeOfCpu(cpu));
+    if (!node) return -1;
+    // Le thread ne peut plus quitter le nœud avant d'être fixé sur un cœur
+    pinCurrentThread(node->cpus);
+    preferNode(node->id);
+    return node->id;
+}
+
+std::vector<int> NumaTopology::parseCpuList(const std::string& list) {
+    std::vector<int> cpus;
+    std::istringstream in(list);
+    std::string range;
+    while (std::getline(in, range, ',')) {
+        if (range.empty() || !std::isdigit(static_cast<unsigned char>(range[0]))) continue;
+        size_t dash = range.find('-');
+        int first = std::stoi(range.substr(0, dash));
+        int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+std::vector<int> NumaTopology::currentAffinity() {
+    std::vector<int> cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+int NumaTopology::currentCpu() {
+    return sched_getcpu();
+}
+
+bool NumaTopology::pinCurrentThread(const std::vector<int>& cpus) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+    }
+    if (CPU_COUNT(&set) == 0) return false;
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+}
+
+bool NumaTopology::preferNode(int node) {
+    unsigned long mask[kMaskWords];
+    if (!nodeMask(node, mask)) return false;
+    return ::syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask, kMaskBits) == 0;
+}
+
+bool NumaTopology::bindMemory(void* addr, size_t bytes, int node) {
+    unsigned long mask[kMaskWords];
+    if (!nodeMask(node, mask)) return false;
+    // Préférence plutôt que MPOL_BIND : un nœud plein déborde au lieu d'échouer
+    return ::syscall(SYS_mbind, addr, bytes, MPOL_PREFERRED, mask, kMaskBits, 0) == 0;
+}
@@ -0,0 +1,131 @@
+// ===== src/utils/ThreadPool.cpp =====
+#include "utils/ThreadPool.hpp"
+#include "utils/NumaTopology.hpp"
+
+ThreadPool::ThreadPool(size_t threads, const ThreadPlacement& placement) {
+    if (threads == 0) threads = 1;
+    
+    queues_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        queues_.push_back(std::make_unique<WorkerQueue>());
+    }
+    
+    // Nœuds connus avant le démarrage : le vol en dépend dès la première tâche
+    workerNodes_.assign(threads, -1);
+    if (placement.mode == ThreadPlacement::Mode::SPREAD) {
+        const NumaTopology& topology = NumaTopology::get();
+        for (size_t i = 0; i < threads; ++i) {
+            workerNodes_[i] = topology.nodeOfCpu(topology.cpuForWorker(i));
+        }
+    } else if (placement.mode == ThreadPlacement::Mode::NODE) {
+        workerNodes_.assign(threads, placement.node);
+    }
+    
+    workers_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back([this, i, placement] {
+            place(i, placement);
+            workerLoop(i);
+        });
+    }
+}
+
+void ThreadPool::place(size_t index, const ThreadPlacement& placement) {
+    if (placement.mode == ThreadPlacement::Mode::NONE) return;
+    
+    const NumaTopology& topology = NumaTopology::get();
+    if (placement.mode == ThreadPlacement::Mode::SPREAD) {
+        NumaTopology::pinCurrentThread({topology.cpuForWorker(index)});
+    } else if (placement.mode == ThreadPlacement::Mode::NODE) {
+        if (const NumaNode* node = topology.findNode(placement.node)) {
+            NumaTopology::pinCurrentThread(node->cpus);
+        }
+    }
+    if (workerNodes_[index] >= 0) {
+        NumaTopology::preferNode(workerNodes_[index]);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    workAvailable_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    size_t index = nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queued_++;
+        pending_++;
+    }
+    workAvailable_.notify_one();
+}
+
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    allDone_.wait(lock, [this] { return pending_ == 0; });
+}
+
+bool ThreadPool::popLocal(size_t index, std::function<void()>& task) {
+    WorkerQueue& queue = *queues_[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) return false;
+    task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    return true;
+}
+
+bool ThreadPool::steal(size_t index, std::function<void()>& task) {
+    // Premier passage : victimes du même nœud ; second : toutes les autres
+    for (int pass = 0; pass < 2; ++pass) {
+        for (size_t offset = 1; offset < queues_.size(); ++offset) {
+            size_t victimIndex = (index + offset) % queues_.size();
+            bool sameNode = workerNodes_[victimIndex] == workerNodes_[index];
+            if (sameNode != (pass == 0)) continue;
+            
+            WorkerQueue& victim = *queues_[victimIndex];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.tasks.empty()) continue;
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+            steals_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(size_t index) {
+    while (true) {
+        std::function<void()> task;
+        if (popLocal(index, task) || steal(index, task)) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                queued_--;
+            }
+            task();
+            
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_ == 0) {
+                allDone_.notify_all();
+            }
+            continue;
+        }
+        
+        // Rien à prendre : dormir jusqu'à la prochaine soumission
+        std::unique_lock<std::mutex> lock(mutex_);
+        workAvailable_.wait(lock, [this] { return stop_ || queued_ > 0; });
+        if (stop_ && queued_ == 0) return;
+    }
+}
@@ -0,0 +1,106 @@
+// ===== tests/test_AsyncFile.cpp =====
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "io/AsyncFile.hpp"
+#include "io/CSVReader.hpp"
+#include "io/CSVWriter.hpp"
+#include "exceptions/Exceptions.hpp"
+
+class AsyncFileTest : public ::testing::Test {
+protected:
+    std::string filename = "test_async_file.csv";
+    std::string copyname = "test_async_file_copy.csv";
+    
+    void TearDown() override {
+        std::remove(filename.c_str());
+        std::remove(copyname.c_str());
+    }
+    
+    void writeFile(const std::string& content) {
+        std::ofstream file(filename, std::ios::binary);
+        file << content;
+    }
+    
+    static std::string readFile(const std::string& name) {
+        std::ifstream file(name, std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+    
+    // Blocs minuscules : nombreuses lectures en vol et lignes à cheval
+    static AsyncIoConfig smallBlocks(IoBackend backend) {
+        AsyncIoConfig config;
+        config.backend = backend;
+        config.blockBytes = 64;
+        config.depth = 3;
+        return config;
+    }
+};
+
+TEST_F(AsyncFileTest, LecturesIdentiquesQuelQueSoitLeBackend) {
+    std::string content = "timestamp,order_id,instrument,side,type,quantity,price,action\n";
+    for (int i = 0; i < 300; ++i) {
+        content += std::to_string(1000 + i) + "," + std::to_string(i + 1) + ",AAPL,BUY,LIMIT,"
+                 + std::to_string(10 + i) + ",150.25,NEW\n";
+        if (i % 40 == 0) content += "\n";
+    }
+    content += "2000,999,MSFT,BUY,LIMIT,5,10,CANCEL";  // Pas de fin de ligne finale
+    writeFile(content);
+    
+    for (IoBackend backend : {IoBackend::SYNC, IoBackend::URING}) {
+        // Les blocs concaténés redonnent le fichier
+        AsyncFileReader file(filename, smallBlocks(backend));
+        std::string blocks;
+        for (std::string_view block = file.next(); !block.empty(); block = file.next()) {
+            EXPECT_LE(block.size(), 64u);
+            blocks.append(block);
+        }
+        EXPECT_EQ(blocks, content) << ioBackendName(backend);
+        EXPECT_TRUE(file.next().empty());
+        
+        std::vector<std::vector<std::string>> rows;
+        CSVReader reader(filename, ',', smallBlocks(backend));
+        reader.skip(2);
+        reader.readLine([&](const std::vector<std::string>& fields) { rows.push_back(fields); });
+        EXPECT_FALSE(reader.hasNext());
+        ASSERT_EQ(rows.size(), 299u) << ioBackendName(backend);
+        EXPECT_EQ(rows.front()[1], "3");
+        EXPECT_EQ(rows.back()[1], "999");
+        EXPECT_EQ(rows.back()[7], "CANCEL");
+    }
+    
+    EXPECT_THROW(AsyncFileReader(filename + ".absent"), FileIOException);
+}
+
+TEST_F(AsyncFileTest, EcrituresIdentiquesQuelQueSoitLeBackend) {
+    OrderEvent event(1000, 7, "AAPL", Side::SELL, OrderType::LIMIT, 100, 101.5, Action::NEW,
+                     OrderStatus::PARTIALLY_EXECUTED, 40, 101.5, 3);
+    
+    std::string outputs[2];
+    for (IoBackend backend : {IoBackend::SYNC, IoBackend::URING}) {
+        const std::string& name = backend == IoBackend::SYNC ? filename : copyname;
+        {
+            // Bien plus de lignes que de tampons : le pool est recyclé
+            CSVWriter writer(name, smallBlocks(backend));
+            writer.writeHeader();
+            for (OrderId id = 1; id <= 500; ++id) {
+                event.orderId = id;
+                writer.writeEvent(event);
+            }
+            writer.flush();
+            writer.writeEvent(event);  // Écrit à la destruction
+        }
+        outputs[backend == IoBackend::SYNC ? 0 : 1] = readFile(name);
+    }
+    
+    EXPECT_EQ(outputs[0], outputs[1]);
+    EXPECT_EQ(outputs[0].rfind("timestamp,order_id", 0), 0u);
+    EXPECT_NE(outputs[0].find("\n1000,250,AAPL,SELL,LIMIT,100,101.50,NEW,PARTIALLY_EXECUTED,40,101.50,3\n"),
+              std::string::npos);
+    size_t lines = 0;
+    for (char c : outputs[0]) lines += c == '\n';
+    EXPECT_EQ(lines, 502u);
+}
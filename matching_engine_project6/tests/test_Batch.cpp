@@ -0,0 +1,125 @@
+// ===== tests/test_Batch.cpp =====
+#include <gtest/gtest.h>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include "io/BatchRunner.hpp"
+#include "utils/ThreadPool.hpp"
+
+class BatchTest : public ::testing::Test {
+protected:
+    std::string dir = "test_batch_dir";
+    
+    void SetUp() override {
+        std::filesystem::create_directories(dir + "/in");
+    }
+    
+    void TearDown() override {
+        std::filesystem::remove_all(dir);
+    }
+    
+    // Fichier d'une journée : `orders` ordres croisés sur deux instruments
+    std::string writeDay(const std::string& name, int orders) {
+        std::string filename = dir + "/in/" + name + ".csv";
+        std::ofstream file(filename);
+        file << "timestamp,order_id,instrument,side,type,quantity,price,action\n";
+        for (int i = 0; i < orders; ++i) {
+            file << (1000 + i) << "," << (i + 1) << "," << (i % 3 == 0 ? "MSFT" : "AAPL") << ","
+                 << (i % 2 == 0 ? "BUY" : "SELL") << ",LIMIT," << (10 + i % 7) << ","
+                 << (100 + i % 5) << ",NEW\n";
+        }
+        return filename;
+    }
+    
+    static std::string readAll(const std::string& filename) {
+        std::ifstream file(filename);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+};
+
+TEST(ThreadPoolTest, ToutesLesTachesExecutees) {
+    std::atomic<int> sum{0};
+    {
+        ThreadPool pool(4);
+        for (int i = 1; i <= 1000; ++i) {
+            pool.submit([&sum, i] { sum += i; });
+        }
+        pool.wait();
+        EXPECT_EQ(sum.load(), 500500);
+        
+        // Le pool reste utilisable après wait()
+        pool.submit([&sum] { sum += 1; });
+    }
+    EXPECT_EQ(sum.load(), 500501);
+}
+
+TEST_F(BatchTest, SortiesIdentiquesAuModeSequentiel) {
+    std::vector<std::string> inputs = {
+        writeDay("2024-01-02", 200), writeDay("2024-01-03", 1500), writeDay("2024-01-04", 700)
+    };
+    
+    EXPECT_EQ(BatchRunner::expandInputs({dir + "/in/2024-01-*.csv"}), inputs);
+    
+    BatchOptions options;
+    options.outputDir = dir + "/out";
+    options.threads = 3;
+    BatchReport report = BatchRunner::run(inputs, options);
+    
+    ASSERT_EQ(report.entries.size(), 3u);
+    EXPECT_EQ(report.getFailureCount(), 0u);
+    EXPECT_EQ(report.getTotalOrders(), 2400u);
+    
+    // Chaque session parallèle produit exactement la sortie d'une exécution seule
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const BatchEntry& entry = report.entries[i];
+        EXPECT_EQ(entry.stats.inputFile, inputs[i]);
+        EXPECT_EQ(entry.outputFile, BatchRunner::outputFileFor(inputs[i], options.outputDir));
+        
+        std::string expected = dir + "/expected.csv";
+        SessionStats stats = Session::run(inputs[i], expected);
+        EXPECT_EQ(entry.stats.eventCount, stats.eventCount);
+        EXPECT_EQ(readAll(entry.outputFile), readAll(expected));
+    }
+    
+    BatchRunner::writeReportCSV(report, options.outputDir + "/batch_report.csv");
+    EXPECT_NE(readAll(options.outputDir + "/batch_report.csv").find("TOTAL,,"), std::string::npos);
+}
+
+TEST_F(BatchTest, RepriseRefuseeAvecEnchere) {
+    std::string input = writeDay("day", 10);
+    std::string output = dir + "/day_out.csv";
+    
+    SessionOptions options;
+    options.journalFile = dir + "/day.journal";
+    options.recover = true;
+    options.openingAuctionEnd = 1005;
+    EXPECT_THROW(Session::run(input, output, options), std::invalid_argument);
+    
+    options.recover = false;
+    options.snapshotIn = dir + "/day.snapshot";
+    options.openingAuctionEnd = 0;
+    options.closingAuctionStart = 1005;
+    EXPECT_THROW(Session::run(input, output, options), std::invalid_argument);
+    EXPECT_FALSE(std::filesystem::exists(output));
+    
+    // Journal sans reprise : accepté
+    options.snapshotIn.clear();
+    EXPECT_EQ(Session::run(input, output, options).orderCount, 10u);
+}
+
+TEST_F(BatchTest, FichierEnEchecSansBloquerLesAutres) {
+    std::vector<std::string> inputs = { writeDay("ok", 100), dir + "/in/missing.csv" };
+    
+    BatchOptions options;
+    options.outputDir = dir + "/out";
+    options.threads = 2;
+    BatchReport report = BatchRunner::run(inputs, options);
+    
+    EXPECT_EQ(report.getFailureCount(), 1u);
+    EXPECT_TRUE(report.entries[0].error.empty());
+    EXPECT_FALSE(report.entries[1].error.empty());
+    EXPECT_EQ(report.getTotalOrders(), 100u);
+}
@@ -0,0 +1,170 @@
+// ===== tests/test_BookView.cpp =====
+#include <gtest/gtest.h>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+#include "core/InstrumentManager.hpp"
+#include "core/MatchingEngine.hpp"
+
+TEST(BookViewTest, PublicationApresChaqueAction) {
+    MatchingEngine engine("AAPL");
+    BookViewConfig config;
+    config.depth = 2;
+    engine.enableBookView(config);
+    const BookView* view = engine.getBookView();
+    ASSERT_NE(view, nullptr);
+    EXPECT_EQ(view->getTopOfBook().bidPrice, 0);
+    
+    engine.processOrder(1000, 1, Side::SELL, OrderType::LIMIT, 100, 101.00, Action::NEW);
+    engine.processOrder(1001, 2, Side::SELL, OrderType::LIMIT, 50, 101.00, Action::NEW);
+    engine.processOrder(1002, 3, Side::SELL, OrderType::LIMIT, 70, 102.00, Action::NEW);
+    engine.processOrder(1003, 4, Side::SELL, OrderType::LIMIT, 30, 103.00, Action::NEW);
+    engine.processOrder(1004, 5, Side::BUY, OrderType::LIMIT, 40, 99.00, Action::NEW);
+    
+    TopOfBook top = view->getTopOfBook();
+    EXPECT_EQ(top.bidPrice, 99.00);
+    EXPECT_EQ(top.bidQuantity, 40);
+    EXPECT_EQ(top.askPrice, 101.00);
+    EXPECT_EQ(top.askQuantity, 150);
+    EXPECT_EQ(top.askOrders, 2);
+    
+    // Profondeur limitée aux 2 meilleurs niveaux, même publication que le meilleur niveau
+    DepthView depth = view->getDepth();
+    EXPECT_EQ(depth.version, top.version);
+    ASSERT_EQ(depth.asks.size(), 2);
+    EXPECT_EQ(depth.asks[0].price, 101.00);
+    EXPECT_EQ(depth.asks[1].price, 102.00);
+    ASSERT_EQ(depth.bids.size(), 1);
+    
+    // Fill complet de 1, partiel de 2
+    engine.processOrder(1005, 6, Side::BUY, OrderType::LIMIT, 120, 101.00, Action::NEW);
+    auto passive = view->findOrder(2);
+    ASSERT_TRUE(passive.has_value());
+    EXPECT_EQ(passive->status, OrderStatus::PARTIALLY_EXECUTED);
+    EXPECT_EQ(passive->remainingQuantity, 30);
+    EXPECT_EQ(passive->executedQuantity, 20);
+    EXPECT_EQ(view->findOrder(1)->status, OrderStatus::EXECUTED);
+    EXPECT_EQ(view->findOrder(6)->status, OrderStatus::EXECUTED);
+    EXPECT_EQ(view->getTopOfBook().lastTradePrice, 101.00);
+    
+    engine.processOrder(1006, 5, Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL);
+    EXPECT_EQ(view->findOrder(5)->status, OrderStatus::CANCELED);
+    EXPECT_EQ(view->getTopOfBook().bidPrice, 0);
+    EXPECT_FALSE(view->findOrder(42).has_value());
+}
+
+TEST(BookViewTest, TablePleineReprendLesOrdresTermines) {
+    MatchingEngine engine("AAPL");
+    BookViewConfig config;
+    config.orderSlots = 4;
+    engine.enableBookView(config);
+    
+    for (OrderId id = 1; id <= 5; ++id) {
+        engine.processOrder(1000 + id, id, Side::BUY, OrderType::LIMIT, 10, 90.0 + id, Action::NEW);
+    }
+    const BookView* view = engine.getBookView();
+    EXPECT_TRUE(view->findOrder(4).has_value());
+    EXPECT_FALSE(view->findOrder(5).has_value());
+    EXPECT_EQ(view->getOverflowCount(), 1);
+    // Meilleur niveau et profondeur ne dépendent pas de la table des ordres
+    EXPECT_EQ(view->getTopOfBook().bidPrice, 95.0);
+    
+    // Ordre terminé : lisible jusqu'à ce qu'un nouvel ordre reprenne son entrée
+    engine.processOrder(2000, 2, Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL);
+    EXPECT_EQ(view->findOrder(2)->status, OrderStatus::CANCELED);
+    engine.processOrder(2001, 6, Side::BUY, OrderType::LIMIT, 10, 80.0, Action::NEW);
+    EXPECT_EQ(view->findOrder(6)->status, OrderStatus::PENDING);
+    EXPECT_FALSE(view->findOrder(2).has_value());
+    EXPECT_EQ(view->getOverflowCount(), 1);
+    
+    // Journée bien plus longue que la table : les ordres exécutés libèrent leur entrée
+    MatchingEngine busy("MSFT");
+    config.orderSlots = 64;
+    busy.enableBookView(config);
+    for (OrderId id = 1; id <= 20000; id += 2) {
+        busy.processOrder(id, id, Side::SELL, OrderType::LIMIT, 10, 100.0, Action::NEW);
+        busy.processOrder(id, id + 1, Side::BUY, OrderType::LIMIT, 10, 100.0, Action::NEW);
+    }
+    EXPECT_EQ(busy.getBookView()->getOverflowCount(), 0);
+    EXPECT_EQ(busy.getBookView()->findOrder(19999)->status, OrderStatus::EXECUTED);
+    EXPECT_EQ(busy.getBookView()->findOrder(20000)->status, OrderStatus::EXECUTED);
+}
+
+TEST(BookViewTest, LecteursConcurrentsVoientDesEtatsCoherents) {
+    InstrumentManager manager;
+    BookViewConfig config;
+    config.orderSlots = 1 << 18;
+    manager.enableBookViews(config);
+    manager.processOrder(1, 1, "AAPL", Side::BUY, OrderType::LIMIT, 10, 99.00, Action::NEW);
+    const BookView* view = manager.findBookView("AAPL");
+    ASSERT_NE(view, nullptr);
+    EXPECT_EQ(manager.findBookView("MSFT"), nullptr);
+    
+    constexpr OrderId kOrders = 100000;
+    std::atomic<bool> done{false};
+    std::atomic<size_t> inconsistencies{0};
+    std::atomic<size_t> reads{0};
+    
+    auto reader = [&](unsigned seed) {
+        std::mt19937_64 random(seed);
+        DepthView depth;
+        uint64_t lastVersion = 0;
+        while (!done.load(std::memory_order_acquire)) {
+            // Carnet jamais croisé en continu
+            TopOfBook top = view->getTopOfBook();
+            if (top.bidPrice > 0 && top.askPrice > 0 && top.bidPrice >= top.askPrice) inconsistencies++;
+            
+            view->readDepth(depth);
+            if (depth.version < lastVersion) inconsistencies++;
+            lastVersion = depth.version;
+            for (size_t i = 1; i < depth.bids.size(); ++i) {
+                if (depth.bids[i].price >= depth.bids[i - 1].price) inconsistencies++;
+            }
+            for (size_t i = 1; i < depth.asks.size(); ++i) {
+                if (depth.asks[i].price <= depth.asks[i - 1].price) inconsistencies++;
+            }
+            if (!depth.bids.empty() && !depth.asks.empty() &&
+                depth.bids[0].price >= depth.asks[0].price) inconsistencies++;
+            
+            auto order = view->findOrder(random() % kOrders + 1);
+            if (order && order->remainingQuantity + order->executedQuantity != order->quantity) {
+                inconsistencies++;
+            }
+            reads++;
+        }
+    };
+    
+    std::vector<std::thread> readers;
+    for (unsigned i = 0; i < 3; ++i) {
+        readers.emplace_back(reader, i);
+    }
+    
+    std::mt19937_64 random(42);
+    for (OrderId id = 2; id <= kOrders; ++id) {
+        Side side = random() % 2 ? Side::BUY : Side::SELL;
+        Price price = 95.0 + static_cast<double>(random() % 100) / 10.0;
+        manager.processOrder(id, id, "AAPL", side, OrderType::LIMIT, random() % 100 + 1, price, Action::NEW);
+        if (id % 7 == 0) {
+            manager.processOrder(id, id - 5, "AAPL", side, OrderType::LIMIT, 0, 0, Action::CANCEL);
+        }
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& thread : readers) {
+        thread.join();
+    }
+    
+    EXPECT_EQ(inconsistencies.load(), 0);
+    EXPECT_GT(reads.load(), 0);
+    
+    // État final identique au carnet
+    const OrderBook& book = manager.getOrCreateEngine("AAPL").getOrderBook();
+    TopOfBook top = view->getTopOfBook();
+    EXPECT_EQ(top.bidPrice, book.getBestBid());
+    EXPECT_EQ(top.askPrice, book.getBestAsk());
+    EXPECT_EQ(top.bidQuantity, book.getBids().getBestLevel()->getTotalQuantity());
+    OrderPtr last = book.findOrder(kOrders);
+    if (last) {
+        EXPECT_EQ(view->findOrder(kOrders)->remainingQuantity, last->getRemainingQuantity());
+    }
+}
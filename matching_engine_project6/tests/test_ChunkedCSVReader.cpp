@@ -0,0 +1,94 @@
+// ===== tests/test_ChunkedCSVReader.cpp =====
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include "io/CSVReader.hpp"
+#include "io/ChunkedCSVReader.hpp"
+#include "exceptions/Exceptions.hpp"
+
+class ChunkedCSVReaderTest : public ::testing::Test {
+protected:
+    std::string filename = "test_chunked.csv";
+    
+    void TearDown() override {
+        std::remove(filename.c_str());
+    }
+    
+    void writeFile(const std::string& content) {
+        std::ofstream file(filename, std::ios::binary);
+        file << content;
+    }
+    
+    std::vector<OrderRecord> readSequential() {
+        std::vector<OrderRecord> records;
+        CSVReader reader(filename);
+        reader.readLine([&](const std::vector<std::string>& fields) {
+            parseOrderRecord(fields, records.emplace_back());
+        });
+        return records;
+    }
+};
+
+TEST_F(ChunkedCSVReaderTest, MemesEnregistrementsQueLaLectureSequentielle) {
+    std::string content = "timestamp,order_id,instrument,side,type,quantity,price,action\n";
+    for (int i = 0; i < 500; ++i) {
+        content += std::to_string(1000 + i) + "," + std::to_string(i + 1) + ", AAPL ,"
+                 + (i % 2 ? "BUY" : "SELL") + "," + (i % 5 ? "LIMIT" : "MARKET") + ","
+                 + std::to_string(10 + i) + "," + (i % 5 ? "150.25" : "na") + ",NEW\n";
+        if (i % 50 == 0) content += "\n";                       // Lignes vides ignorées
+        if (i % 70 == 0) content += "1,2,AAPL,BUY\n";           // Champs manquants
+        if (i % 90 == 0) content += "x,2,AAPL,BUY,LIMIT,1,1,NEW\n";  // Erreur de parsing
+    }
+    content += "2000,999,MSFT,BUY,LIMIT,5,10,CANCEL";           // Pas de fin de ligne finale
+    writeFile(content);
+    
+    std::vector<OrderRecord> expected = readSequential();
+    
+    // Tranches minuscules : nombreuses coupures au milieu des lignes
+    ChunkedCSVReader reader(filename, 4, 64);
+    EXPECT_GT(reader.getChunkCount(), 100u);
+    
+    std::vector<OrderRecord> records;
+    reader.readRecords([&](const OrderRecord& record) { records.push_back(record); });
+    
+    ASSERT_EQ(records.size(), expected.size());
+    for (size_t i = 0; i < records.size(); ++i) {
+        EXPECT_EQ(records[i].status, expected[i].status) << "record " << i;
+        EXPECT_EQ(records[i].error, expected[i].error);
+        if (!expected[i].isValid()) continue;
+        EXPECT_EQ(records[i].timestamp, expected[i].timestamp);
+        EXPECT_EQ(records[i].orderId, expected[i].orderId);
+        EXPECT_EQ(records[i].instrument, expected[i].instrument);
+        EXPECT_EQ(records[i].side, expected[i].side);
+        EXPECT_EQ(records[i].type, expected[i].type);
+        EXPECT_EQ(records[i].quantity, expected[i].quantity);
+        EXPECT_DOUBLE_EQ(records[i].price, expected[i].price);
+        EXPECT_EQ(records[i].action, expected[i].action);
+    }
+    EXPECT_EQ(records.back().action, Action::CANCEL);
+}
+
+TEST_F(ChunkedCSVReaderTest, SautEtNumeroDeLigne) {
+    writeFile("header\n"
+              "1,1,AAPL,BUY,LIMIT,10,100,NEW\n"
+              "\n"
+              "2,2,AAPL,BUY,LIMIT,10,100,NEW\n"
+              "3,3,AAPL,BUY,LIMIT,10,100,NEW\n"
+              "4,4,AAPL,BUY,LIMIT,10,100,NEW\n");
+    
+    ChunkedCSVReader reader(filename, 2, 8);
+    reader.skip(2);
+    
+    std::vector<OrderId> ids;
+    try {
+        reader.readRecords([&](const OrderRecord& record) {
+            ids.push_back(record.orderId);
+            if (record.orderId == 4) throw std::runtime_error("stop");
+        });
+        FAIL() << "CSVParsingException attendue";
+    } catch (const CSVParsingException& e) {
+        // Header = ligne 1, la ligne vide compte : l'ordre 4 est en ligne 6
+        EXPECT_EQ(std::string(e.what()), "Line 6: stop");
+    }
+    EXPECT_EQ(ids, (std::vector<OrderId>{3, 4}));
+}
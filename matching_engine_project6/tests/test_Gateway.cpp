@@ -0,0 +1,193 @@
+// ===== tests/test_Gateway.cpp =====
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "core/InstrumentManager.hpp"
+#include "io/OrderGateway.hpp"
+
+namespace {
+    int connectUnix(const std::string& path) {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+        int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            ::close(fd);
+            return -1;
+        }
+        return fd;
+    }
+    
+    int connectTcp(uint16_t port) {
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(port);
+        int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            ::close(fd);
+            return -1;
+        }
+        return fd;
+    }
+    
+    void sendOrder(int fd, OrderId id, Side side, Quantity quantity, Price price,
+                   Action action = Action::NEW) {
+        GatewayOrder message;
+        ASSERT_TRUE(encodeGatewayOrder(message, 1000 + id, id, "AAPL", side, OrderType::LIMIT,
+                                       quantity, price, action));
+        ASSERT_EQ(::send(fd, &message, sizeof(message), MSG_NOSIGNAL), static_cast<ssize_t>(sizeof(message)));
+    }
+    
+    // Lit exactement `count` événements (bloquant)
+    std::vector<GatewayEvent> receiveEvents(int fd, size_t count) {
+        std::vector<GatewayEvent> events(count);
+        size_t expected = count * sizeof(GatewayEvent);
+        size_t received = 0;
+        char* bytes = reinterpret_cast<char*>(events.data());
+        while (received < expected) {
+            ssize_t n = ::recv(fd, bytes + received, expected - received, 0);
+            if (n <= 0) break;
+            received += static_cast<size_t>(n);
+        }
+        events.resize(received / sizeof(GatewayEvent));
+        return events;
+    }
+}
+
+TEST(GatewayTest, EvenementsAEmetteurEtDropCopy) {
+    std::string path = "/tmp/test_gateway_" + std::to_string(::getpid()) + ".sock";
+    InstrumentManager manager;
+    GatewayConfig config;
+    config.endpoint = "unix:" + path;
+    OrderGateway gateway(manager, config);
+    std::thread server([&] { gateway.run(); });
+    
+    int dropCopy = connectUnix(path);
+    int seller = connectUnix(path);
+    int buyer = connectUnix(path);
+    ASSERT_GE(dropCopy, 0);
+    ASSERT_GE(seller, 0);
+    ASSERT_GE(buyer, 0);
+    
+    GatewaySubscribe subscribe{gatewayHeader<GatewaySubscribe>(GatewayMessageType::SUBSCRIBE), 0};
+    ASSERT_EQ(::send(dropCopy, &subscribe, sizeof(subscribe), 0), static_cast<ssize_t>(sizeof(subscribe)));
+    
+    // L'ordre passif est accusé avant l'envoi de l'ordre agressif
+    sendOrder(seller, 1, Side::SELL, 100, 101.00);
+    auto sellerEvents = receiveEvents(seller, 1);
+    ASSERT_EQ(sellerEvents.size(), 1);
+    EXPECT_EQ(sellerEvents[0].orderId, 1);
+    EXPECT_EQ(sellerEvents[0].status, static_cast<uint8_t>(OrderStatus::PENDING));
+    EXPECT_EQ(std::string(sellerEvents[0].symbol, sellerEvents[0].symbolLength), "AAPL");
+    
+    // Fill partiel du passif : événements du passif et de l'agresseur, à l'émetteur
+    sendOrder(buyer, 2, Side::BUY, 40, 101.00);
+    auto buyerEvents = receiveEvents(buyer, 2);
+    ASSERT_EQ(buyerEvents.size(), 2);
+    EXPECT_EQ(buyerEvents[0].orderId, 1);
+    EXPECT_EQ(buyerEvents[0].status, static_cast<uint8_t>(OrderStatus::PARTIALLY_EXECUTED));
+    EXPECT_EQ(buyerEvents[1].orderId, 2);
+    EXPECT_EQ(buyerEvents[1].status, static_cast<uint8_t>(OrderStatus::EXECUTED));
+    EXPECT_EQ(buyerEvents[1].executedQuantity, 40);
+    EXPECT_EQ(buyerEvents[1].counterpartyId, 1);
+    
+    sendOrder(seller, 1, Side::SELL, 0, 0, Action::CANCEL);
+    sellerEvents = receiveEvents(seller, 1);
+    ASSERT_EQ(sellerEvents.size(), 1);
+    EXPECT_EQ(sellerEvents[0].status, static_cast<uint8_t>(OrderStatus::CANCELED));
+    
+    // Le drop copy reçoit tous les événements, dans l'ordre du moteur
+    auto copied = receiveEvents(dropCopy, 4);
+    ASSERT_EQ(copied.size(), 4);
+    EXPECT_EQ(copied[0].orderId, 1);
+    EXPECT_EQ(copied[1].orderId, 1);
+    EXPECT_EQ(copied[2].orderId, 2);
+    EXPECT_EQ(copied[3].status, static_cast<uint8_t>(OrderStatus::CANCELED));
+    
+    ::close(dropCopy);
+    ::close(seller);
+    ::close(buyer);
+    gateway.stop();
+    server.join();
+    
+    // Carnet vidé, événements libérés du moteur après diffusion
+    MatchingEngine& engine = manager.getOrCreateEngine("AAPL");
+    EXPECT_TRUE(engine.getEvents().empty());
+    EXPECT_EQ(engine.getOrderBook().getBestAsk(), 0);
+    
+    const GatewayStats& stats = gateway.getStats();
+    EXPECT_EQ(stats.connections, 3);
+    EXPECT_EQ(stats.messages, 3);
+    EXPECT_EQ(stats.events, 4);
+    EXPECT_EQ(stats.protocolErrors, 0);
+}
+
+TEST(GatewayTest, MessageInvalideFermeLaConnexion) {
+    InstrumentManager manager;
+    GatewayConfig config;
+    config.endpoint = "tcp:0";
+    OrderGateway gateway(manager, config);
+    ASSERT_NE(gateway.getPort(), 0);
+    std::thread server([&] { gateway.run(); });
+    
+    int valid = connectTcp(gateway.getPort());
+    int invalid = connectTcp(gateway.getPort());
+    ASSERT_GE(valid, 0);
+    ASSERT_GE(invalid, 0);
+    
+    // Mauvaise version de protocole
+    GatewayOrder message;
+    ASSERT_TRUE(encodeGatewayOrder(message, 1000, 1, "AAPL", Side::BUY, OrderType::LIMIT,
+                                   10, 99.00, Action::NEW));
+    message.header.version = kGatewayProtocolVersion + 1;
+    ::send(invalid, &message, sizeof(message), MSG_NOSIGNAL);
+    char byte;
+    EXPECT_EQ(::recv(invalid, &byte, 1, 0), 0);
+    
+    // Côté invalide d'un message bien formé
+    int badSide = connectTcp(gateway.getPort());
+    ASSERT_TRUE(encodeGatewayOrder(message, 1000, 2, "AAPL", Side::BUY, OrderType::LIMIT,
+                                   10, 99.00, Action::NEW));
+    message.side = 7;
+    ::send(badSide, &message, sizeof(message), MSG_NOSIGNAL);
+    EXPECT_EQ(::recv(badSide, &byte, 1, 0), 0);
+    
+    // Symbole vide : aucun carnet sans nom n'est créé
+    int noSymbol = connectTcp(gateway.getPort());
+    ASSERT_TRUE(encodeGatewayOrder(message, 1000, 4, "AAPL", Side::BUY, OrderType::LIMIT,
+                                   10, 99.00, Action::NEW));
+    EXPECT_FALSE(encodeGatewayOrder(message, 1000, 4, "", Side::BUY, OrderType::LIMIT,
+                                    10, 99.00, Action::NEW));
+    message.symbolLength = 0;
+    ::send(noSymbol, &message, sizeof(message), MSG_NOSIGNAL);
+    EXPECT_EQ(::recv(noSymbol, &byte, 1, 0), 0);
+    
+    // Les autres connexions ne sont pas affectées ; message envoyé en deux fois
+    ASSERT_TRUE(encodeGatewayOrder(message, 1000, 3, "AAPL", Side::BUY, OrderType::LIMIT,
+                                   10, 99.00, Action::NEW));
+    const char* bytes = reinterpret_cast<const char*>(&message);
+    ::send(valid, bytes, 10, MSG_NOSIGNAL);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ::send(valid, bytes + 10, sizeof(message) - 10, MSG_NOSIGNAL);
+    auto events = receiveEvents(valid, 1);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].orderId, 3);
+    
+    ::close(valid);
+    ::close(invalid);
+    ::close(badSide);
+    ::close(noSymbol);
+    gateway.stop();
+    server.join();
+    EXPECT_EQ(gateway.getStats().protocolErrors, 3);
+    EXPECT_EQ(gateway.getStats().messages, 1);
+    EXPECT_EQ(manager.getEngineCount(), 1);
+}
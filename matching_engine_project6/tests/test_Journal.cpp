@@ -0,0 +1,115 @@
+// ===== tests/test_Journal.cpp =====
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <unistd.h>
+#include "core/InstrumentManager.hpp"
+#include "io/JournalReader.hpp"
+#include "io/JournalWriter.hpp"
+#include "exceptions/Exceptions.hpp"
+
+class JournalTest : public ::testing::Test {
+protected:
+    std::string filename = "test_journal.bin";
+    
+    void TearDown() override {
+        std::remove(filename.c_str());
+    }
+    
+    static void feed(InstrumentManager& manager) {
+        manager.processOrder(1000, 1, "AAPL", Side::SELL, OrderType::LIMIT, 100, 150.00, Action::NEW);
+        manager.processOrder(1001, 2, "AAPL", Side::SELL, OrderType::LIMIT, 200, 151.00, Action::NEW);
+        manager.processOrder(1002, 3, "MSFT", Side::BUY, OrderType::LIMIT, 50, 300.00, Action::NEW);
+        manager.processOrder(1003, 4, "AAPL", Side::BUY, OrderType::MARKET, 150, 0.0, Action::NEW);
+        manager.processOrder(1004, 3, "MSFT", Side::BUY, OrderType::LIMIT, 80, 301.00, Action::MODIFY);
+    }
+};
+
+TEST_F(JournalTest, GroupCommitEtReprise) {
+    InstrumentManager original;
+    JournalConfig config;
+    config.groupCommitRecords = 2;
+    config.groupCommitMicros = 100000;
+    {
+        JournalWriter journal(filename, config);
+        original.setJournal(&journal);
+        feed(original);
+        journal.flush();
+        original.setJournal(nullptr);
+        
+        EXPECT_EQ(journal.getAppendedCount(), 5);
+        EXPECT_EQ(journal.getDurableCount(), 5);
+        EXPECT_GE(journal.getCommitCount(), 3);  // Lots de 2 au plus
+    }
+    
+    InstrumentManager recovered;
+    JournalRecovery recovery = JournalReader::recover(filename, recovered);
+    EXPECT_EQ(recovery.records, 5);
+    EXPECT_EQ(recovery.applied, 5);
+    EXPECT_FALSE(recovery.tornTail);
+    
+    // Le rejeu reconstruit exactement les mêmes événements
+    auto expected = original.getAllEvents();
+    auto actual = recovered.getAllEvents();
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(actual[i].orderId, expected[i].orderId);
+        EXPECT_EQ(actual[i].status, expected[i].status);
+        EXPECT_EQ(actual[i].executedQuantity, expected[i].executedQuantity);
+    }
+}
+
+TEST_F(JournalTest, FinTronqueeSupprimee) {
+    {
+        InstrumentManager manager;
+        JournalWriter journal(filename);
+        manager.setJournal(&journal);
+        feed(manager);
+        journal.flush();
+        manager.setJournal(nullptr);
+    }
+    
+    // Simuler un crash au milieu de l'écriture du dernier enregistrement
+    ASSERT_EQ(::truncate(filename.c_str(), 4 * sizeof(JournalRecord) + 10), 0);
+    
+    InstrumentManager recovered;
+    JournalRecovery recovery = JournalReader::recover(filename, recovered);
+    EXPECT_EQ(recovery.records, 4);
+    EXPECT_TRUE(recovery.tornTail);
+    
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    EXPECT_EQ(static_cast<size_t>(file.tellg()), 4 * sizeof(JournalRecord));
+    
+    // Le journal se complète à partir du dernier enregistrement valide
+    {
+        JournalWriter journal(filename, {}, recovery.records);
+        recovered.setJournal(&journal);
+        recovered.processOrder(1004, 3, "MSFT", Side::BUY, OrderType::LIMIT, 80, 301.00, Action::MODIFY);
+        journal.flush();
+        recovered.setJournal(nullptr);
+    }
+    
+    InstrumentManager again;
+    recovery = JournalReader::recover(filename, again);
+    EXPECT_EQ(recovery.records, 5);
+    EXPECT_FALSE(recovery.tornTail);
+}
+
+TEST_F(JournalTest, ErreurDEcritureJamaisDeclareeDurable) {
+    // /dev/full : chaque écriture échoue (ENOSPC)
+    JournalConfig config;
+    config.groupCommitRecords = 1;
+    JournalWriter journal("/dev/full", config, 1);
+    // Les lots suivant l'échec ne sont pas écrits : l'ajout échoue ou reste non durable
+    for (OrderId id = 1; id <= 5; ++id) {
+        try {
+            journal.append(1000, id, "AAPL", Side::BUY, OrderType::LIMIT, 10, 99.00, Action::NEW);
+        } catch (const FileIOException&) {
+            break;
+        }
+    }
+    EXPECT_THROW(journal.flush(), FileIOException);
+    EXPECT_EQ(journal.getDurableCount(), 1);  // Séquence de départ inchangée
+    EXPECT_EQ(journal.getCommitCount(), 0);
+    EXPECT_THROW(journal.flush(), FileIOException);
+}
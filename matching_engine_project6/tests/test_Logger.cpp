@@ -0,0 +1,66 @@
+// ===== tests/test_Logger.cpp =====
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "utils/Logger.hpp"
+
+class LoggerTest : public ::testing::Test {
+protected:
+    std::string filename = "test_logger.log";
+    
+    void SetUp() override {
+        std::remove(filename.c_str());
+    }
+    
+    void TearDown() override {
+        Logger::close();
+        std::remove(filename.c_str());
+    }
+    
+    std::vector<std::string> readLines() {
+        std::ifstream file(filename);
+        std::vector<std::string> lines;
+        for (std::string line; std::getline(file, line);) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+};
+
+TEST_F(LoggerTest, FormatageDiffereDesEnregistrementsBinaires) {
+    Logger::init(filename);
+    Logger::write(LogFormat::ORDERS_PROCESSED, size_t{10000});
+    Logger::write(LogFormat::AUCTION_UNCROSS, uint64_t{2000}, uint64_t{350});
+    Logger::log("Snapshot written", LogLevel::WARNING);
+    // Sous le niveau compilé (INFO par défaut) : rien n'est enregistré
+    Logger::write<LogLevel::DEBUG>(LogFormat::ORDER_REJECTED, uint64_t{7}, 5);
+    Logger::close();
+    
+    auto lines = readLines();
+    ASSERT_EQ(lines.size(), kMinLogLevel <= LogLevel::DEBUG ? 4u : 3u);
+    EXPECT_NE(lines[0].find("INFO - Processed 10000 orders"), std::string::npos);
+    EXPECT_NE(lines[1].find("Auction uncross at 2000: 350 executed"), std::string::npos);
+    EXPECT_NE(lines[2].find("WARNING - Snapshot written"), std::string::npos);
+}
+
+TEST_F(LoggerTest, UneFileParThreadSansPerte) {
+    Logger::init(filename);
+    constexpr int kThreads = 4;
+    constexpr int kRecords = 1000;  // Sous la capacité d'une file : aucune perte
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < kRecords; ++i) {
+                Logger::write(LogFormat::ORDER_REJECTED, static_cast<uint64_t>(t * kRecords + i), 1);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    Logger::close();
+    
+    EXPECT_EQ(readLines().size(), static_cast<size_t>(kThreads * kRecords));
+    EXPECT_EQ(Logger::getDroppedCount(), 0u);
+}
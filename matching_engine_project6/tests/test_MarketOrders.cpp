@@ -115,10 +115,10 @@ TEST_F(MarketOrderTest, ModificationOrdreMarketInterdit) {
     // Créer un ordre MARKET
     manager.processOrder(5000, 40, "AAPL", Side::BUY, OrderType::MARKET, 50, 0.0, Action::NEW);
     
-    // Tenter de modifier un ordre MARKET devrait échouer
-    EXPECT_THROW(
+    // Tenter de modifier un ordre MARKET (annulé, hors carnet) est rejeté
+    EXPECT_NE(
         manager.processOrder(5001, 40, "AAPL", Side::BUY, OrderType::MARKET, 100, 0.0, Action::MODIFY),
-        InvalidOrderException
+        OrderRejection::NONE
     );
 }
 
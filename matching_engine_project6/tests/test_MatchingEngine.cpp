@@ -1,6 +1,9 @@
 // ===== tests/test_MatchingEngine.cpp =====
 #include <gtest/gtest.h>
 #include "core/MatchingEngine.hpp"
+#include "core/InstrumentManager.hpp"
+#include "io/MetricsExporter.hpp"
+#include "utils/ThreadPool.hpp"
 #include "utils/TimeUtils.hpp"
 #include "exceptions/Exceptions.hpp"
 
@@ -12,7 +15,7 @@ protected:
         engine = std::make_unique<MatchingEngine>("AAPL");
     }
     
-    const OrderEvent* findEvent(const std::vector<OrderEvent>& events, 
+    const OrderEvent* findEvent(const std::pmr::vector<OrderEvent>& events, 
                                OrderId orderId, OrderStatus status) {
         for (const auto& event : events) {
             if (event.orderId == orderId && event.status == status) {
@@ -93,22 +96,76 @@ TEST_F(MatchingEngineTest, ActionCancel) {
     // L'ordre ne devrait plus être dans le carnet actif
     auto orderInBook = engine->getOrderBook().findOrder(1);
     EXPECT_EQ(orderInBook, nullptr);
+    
+    // CANCEL tardif d'un ordre annulé puis d'un ordre exécuté : rejetés
+    EXPECT_EQ(engine->processOrder(2001, 1, Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL),
+              OrderRejection::ORDER_CLOSED);
+    engine->processOrder(2002, 2, Side::SELL, OrderType::LIMIT, 50, 150.00, Action::NEW);
+    engine->processOrder(2003, 3, Side::BUY, OrderType::LIMIT, 50, 150.00, Action::NEW);
+    EXPECT_EQ(engine->processOrder(2004, 2, Side::SELL, OrderType::LIMIT, 0, 0, Action::CANCEL),
+              OrderRejection::ORDER_CLOSED);
+    EXPECT_EQ(events.back().orderId, 2);
+    EXPECT_EQ(events.back().action, Action::CANCEL);
+    EXPECT_EQ(events.back().status, OrderStatus::REJECTED);
+    EXPECT_EQ(engine->getRejectCount(OrderRejection::ORDER_CLOSED), 2u);
+    EXPECT_EQ(engine->getOrder(2)->getStatus(), OrderStatus::EXECUTED);
 }
 
 TEST_F(MatchingEngineTest, ModifyOrderNotFound) {
-    // Tenter de modifier un ordre inexistant
-    EXPECT_THROW(
-        engine->processOrder(1000, 999, Side::BUY, OrderType::LIMIT, 100, 150.00, Action::MODIFY),
-        OrderNotFoundException
-    );
+    // Modifier un ordre inexistant : rejet sans exception
+    EXPECT_EQ(engine->processOrder(1000, 999, Side::BUY, OrderType::LIMIT, 100, 150.00, Action::MODIFY),
+              OrderRejection::UNKNOWN_ORDER);
+    const OrderEvent& event = engine->getEvents().back();
+    EXPECT_EQ(event.orderId, 999);
+    EXPECT_EQ(event.action, Action::MODIFY);
+    EXPECT_EQ(event.status, OrderStatus::REJECTED);
 }
 
 TEST_F(MatchingEngineTest, CancelOrderNotFound) {
-    // Tenter d'annuler un ordre inexistant
-    EXPECT_THROW(
-        engine->processOrder(1000, 999, Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL),
-        OrderNotFoundException
-    );
+    // Annuler un ordre inexistant : rejet sans exception
+    EXPECT_EQ(engine->processOrder(1000, 999, Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL),
+              OrderRejection::UNKNOWN_ORDER);
+    EXPECT_EQ(engine->getEvents().back().status, OrderStatus::REJECTED);
+    EXPECT_EQ(engine->getRejectCount(OrderRejection::UNKNOWN_ORDER), 1u);
+}
+
+TEST_F(MatchingEngineTest, RejetsOrdresInvalidesEtCompteurs) {
+    EXPECT_EQ(engine->processOrder(1000, 1, Side::BUY, OrderType::LIMIT, 0, 150.00, Action::NEW),
+              OrderRejection::INVALID_QUANTITY);
+    EXPECT_EQ(engine->processOrder(1000, 2, Side::BUY, OrderType::LIMIT, 100, 0, Action::NEW),
+              OrderRejection::INVALID_PRICE);
+    EXPECT_EQ(engine->processOrder(1000, 0, Side::BUY, OrderType::LIMIT, 100, 150.00, Action::NEW),
+              OrderRejection::INVALID_ORDER_ID);
+    EXPECT_EQ(engine->getOrder(1), nullptr);
+    EXPECT_EQ(engine->getOrderBook().getOrderCount(), 0);
+    
+    // MODIFY : quantité pas au-delà de l'exécuté, prix invalide ; l'ordre reste inchangé
+    engine->processOrder(1001, 3, Side::BUY, OrderType::LIMIT, 100, 150.00, Action::NEW);
+    engine->processOrder(1002, 4, Side::SELL, OrderType::LIMIT, 40, 150.00, Action::NEW);
+    EXPECT_EQ(engine->processOrder(1003, 3, Side::BUY, OrderType::LIMIT, 40, 150.00, Action::MODIFY),
+              OrderRejection::INVALID_QUANTITY);
+    EXPECT_EQ(engine->processOrder(1004, 3, Side::BUY, OrderType::LIMIT, 100, -1.00, Action::MODIFY),
+              OrderRejection::INVALID_PRICE);
+    EXPECT_EQ(engine->getOrder(3)->getRemainingQuantity(), 60);
+    EXPECT_DOUBLE_EQ(engine->getOrder(3)->getPrice(), 150.00);
+    
+    EXPECT_EQ(engine->getRejectCount(OrderRejection::INVALID_QUANTITY), 2u);
+    EXPECT_EQ(engine->getRejectCount(OrderRejection::INVALID_PRICE), 2u);
+    EXPECT_EQ(engine->getRejectCount(OrderRejection::INVALID_ORDER_ID), 1u);
+    EXPECT_EQ(engine->getEvents().back().status, OrderStatus::REJECTED);
+    
+    // NEW avec l'identifiant d'un ordre actif : rejeté, l'ordre d'origine est intact
+    EXPECT_EQ(engine->processOrder(1005, 3, Side::BUY, OrderType::LIMIT, 500, 151.00, Action::NEW),
+              OrderRejection::DUPLICATE_ORDER_ID);
+    EXPECT_EQ(engine->getOrder(3)->getRemainingQuantity(), 60);
+    EXPECT_DOUBLE_EQ(engine->getOrder(3)->getPrice(), 150.00);
+    engine->processOrder(1006, 5, Side::SELL, OrderType::LIMIT, 60, 150.00, Action::NEW);
+    EXPECT_EQ(engine->getOrder(3)->getStatus(), OrderStatus::EXECUTED);
+    EXPECT_EQ(engine->getOrderBook().getOrderCount(), 0);
+    // Identifiant d'un ordre terminé : réutilisable
+    EXPECT_EQ(engine->processOrder(1007, 3, Side::BUY, OrderType::LIMIT, 10, 140.00, Action::NEW),
+              OrderRejection::NONE);
+    EXPECT_EQ(engine->getRejectCount(OrderRejection::DUPLICATE_ORDER_ID), 1u);
 }
 
 
@@ -145,6 +202,200 @@ TEST_F(MatchingEngineTest, ModifyThenExecute) {
     EXPECT_TRUE(foundBuyExecuted);
 }
 
+TEST_F(MatchingEngineTest, ModificationBaisseConservePriorite) {
+    engine->processOrder(1000, 1, Side::BUY, OrderType::LIMIT, 100, 150.00, Action::NEW);
+    engine->processOrder(1001, 2, Side::BUY, OrderType::LIMIT, 100, 150.00, Action::NEW);
+    engine->processOrder(1002, 3, Side::BUY, OrderType::LIMIT, 50, 150.00, Action::NEW);
+    
+    // Baisse au même prix : sur place, le niveau est ajusté sans perte de priorité
+    engine->processOrder(2000, 1, Side::BUY, OrderType::LIMIT, 60, 150.00, Action::MODIFY);
+    const OrderEvent& modifyEvent = engine->getEvents().back();
+    EXPECT_EQ(modifyEvent.orderId, 1);
+    EXPECT_EQ(modifyEvent.action, Action::MODIFY);
+    EXPECT_EQ(modifyEvent.status, OrderStatus::PENDING);
+    EXPECT_EQ(modifyEvent.displayQuantity, 60);
+    const PriceLevel* level = engine->getOrderBook().getBids().getBestLevel();
+    ASSERT_NE(level, nullptr);
+    EXPECT_EQ(level->getTotalQuantity(), 210);
+    EXPECT_EQ(level->getFrontOrder()->getOrderId(), 1);
+    
+    // Hausse : l'ordre 2 repasse derrière l'ordre 3
+    engine->processOrder(2001, 2, Side::BUY, OrderType::LIMIT, 120, 150.00, Action::MODIFY);
+    EXPECT_EQ(level->getTotalQuantity(), 230);
+    
+    engine->processOrder(3000, 4, Side::SELL, OrderType::LIMIT, 110, 150.00, Action::NEW);
+    EXPECT_EQ(engine->getOrder(1)->getStatus(), OrderStatus::EXECUTED);
+    EXPECT_EQ(engine->getOrder(3)->getStatus(), OrderStatus::EXECUTED);
+    EXPECT_EQ(engine->getOrder(2)->getRemainingQuantity(), 120);
+}
+
+TEST_F(MatchingEngineTest, AnnulationDeMassePerimetre) {
+    OrderOptions owner7;
+    owner7.owner = 7;
+    engine->processOrder(1000, 1, Side::BUY, OrderType::LIMIT, 100, 150.00, Action::NEW, owner7);
+    engine->processOrder(1001, 2, Side::BUY, OrderType::LIMIT, 100, 150.00, Action::NEW);
+    engine->processOrder(1002, 3, Side::BUY, OrderType::LIMIT, 100, 149.00, Action::NEW, owner7);
+    engine->processOrder(1003, 4, Side::SELL, OrderType::LIMIT, 100, 152.00, Action::NEW, owner7);
+    engine->processOrder(1004, 5, Side::SELL, OrderType::LIMIT, 100, 155.00, Action::NEW);
+    OrderOptions stop7 = owner7;
+    stop7.stopPrice = 160.00;
+    engine->processOrder(1005, 6, Side::BUY, OrderType::MARKET, 100, 0, Action::NEW, stop7);
+    
+    // Propriétaire 7, achats à 149.50 ou plus : seul l'ordre 1 (le stop au marché n'a pas de prix)
+    MassCancelFilter filter;
+    filter.allSides = false;
+    filter.side = Side::BUY;
+    filter.owner = 7;
+    filter.priceBound = 149.50;
+    size_t before = engine->getEvents().size();
+    EXPECT_EQ(engine->massCancel(2000, filter), 1u);
+    EXPECT_EQ(engine->getOrder(1)->getStatus(), OrderStatus::CANCELED);
+    EXPECT_EQ(engine->getOrder(3)->getStatus(), OrderStatus::PENDING);
+    EXPECT_EQ(engine->getOrderBook().getBids().getBestLevel()->getTotalQuantity(), 100);
+    
+    // Propriétaire 7, tous côtés et prix : ordres 3, 4 et le stop 6
+    EXPECT_EQ(engine->massCancel(2001, MassCancelFilter{true, Side::BUY, 7, 0}), 3u);
+    EXPECT_TRUE(engine->getOrderBook().getStops().isEmpty());
+    
+    // Tout l'instrument : niveaux retirés en entier
+    EXPECT_EQ(engine->massCancel(2002, MassCancelFilter{}), 2u);
+    EXPECT_TRUE(engine->getOrderBook().getBids().isEmpty());
+    EXPECT_TRUE(engine->getOrderBook().getAsks().isEmpty());
+    EXPECT_EQ(engine->getOrderBook().getOrderCount(), 0u);
+    
+    const auto& events = engine->getEvents();
+    ASSERT_EQ(events.size() - before, 6u);
+    for (size_t i = before; i < events.size(); ++i) {
+        EXPECT_EQ(events[i].status, OrderStatus::CANCELED);
+        EXPECT_EQ(events[i].action, Action::CANCEL);
+    }
+}
+
+TEST_F(MatchingEngineTest, ControlesPreTradeEtExposition) {
+    RiskLimits limits;
+    limits.maxOrderQuantity = 500;
+    limits.priceCollar = 0.05;
+    limits.maxPosition = 300;
+    limits.maxOpenNotional = 50000;
+    engine->setRiskLimits(limits);
+    
+    OrderOptions account;
+    account.owner = 7;
+    engine->processOrder(1000, 1, Side::SELL, OrderType::LIMIT, 200, 100.00, Action::NEW);
+    
+    // Taille et collier : rejet sans toucher au carnet
+    engine->processOrder(1001, 2, Side::BUY, OrderType::LIMIT, 600, 100.00, Action::NEW, account);
+    EXPECT_EQ(engine->getEvents().back().status, OrderStatus::REJECTED);
+    engine->processOrder(1002, 3, Side::BUY, OrderType::LIMIT, 100, 106.00, Action::NEW, account);
+    EXPECT_EQ(engine->getEvents().back().status, OrderStatus::REJECTED);
+    EXPECT_EQ(engine->getOrder(3), nullptr);
+    
+    // Achat de 250 : 200 exécutés, 50 au repos
+    engine->processOrder(1003, 4, Side::BUY, OrderType::LIMIT, 250, 100.00, Action::NEW, account);
+    const AccountExposure* exposure = engine->getRisk().findAccount(7);
+    ASSERT_NE(exposure, nullptr);
+    EXPECT_EQ(exposure->position, 200);
+    EXPECT_EQ(exposure->openBuy, 50u);
+    EXPECT_DOUBLE_EQ(exposure->openNotional, 5000.0);
+    
+    // 200 + 50 + 60 > 300 : rejet sur la position, ordres ouverts compris
+    engine->processOrder(1004, 5, Side::BUY, OrderType::LIMIT, 60, 99.00, Action::NEW, account);
+    EXPECT_EQ(engine->getEvents().back().status, OrderStatus::REJECTED);
+    EXPECT_EQ(engine->getRisk().check(engine->getOrderBook(), Side::BUY, OrderType::LIMIT, 60, 99.00, 7),
+              RiskRejection::POSITION);
+    // Une vente réduit la position : seul le notionnel la limite
+    EXPECT_EQ(engine->getRisk().check(engine->getOrderBook(), Side::SELL, OrderType::LIMIT, 460, 99.00, 7),
+              RiskRejection::OPEN_NOTIONAL);
+    
+    // Modification rejetée : l'ordre reste inchangé ; annulation : exposition libérée
+    engine->processOrder(1005, 4, Side::BUY, OrderType::LIMIT, 400, 100.00, Action::MODIFY);
+    EXPECT_EQ(engine->getEvents().back().status, OrderStatus::REJECTED);
+    EXPECT_EQ(engine->getOrder(4)->getRemainingQuantity(), 50u);
+    engine->processOrder(1006, 4, Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL);
+    EXPECT_EQ(exposure->openBuy, 0u);
+    EXPECT_DOUBLE_EQ(exposure->openNotional, 0.0);
+    EXPECT_EQ(exposure->position, 200);
+}
+
+TEST_F(MatchingEngineTest, BandeDePrixEtSuspension) {
+    PriceBand band;
+    band.width = 2.00;
+    band.maxLevels = 2;
+    band.haltDuration = 500;
+    engine->setPriceBand(band);
+    
+    engine->processOrder(1000, 1, Side::SELL, OrderType::LIMIT, 100, 100.00, Action::NEW);
+    engine->processOrder(1000, 2, Side::SELL, OrderType::LIMIT, 100, 101.00, Action::NEW);
+    engine->processOrder(1000, 3, Side::SELL, OrderType::LIMIT, 100, 102.00, Action::NEW);
+    engine->processOrder(1000, 4, Side::SELL, OrderType::LIMIT, 100, 103.00, Action::NEW);
+    engine->processOrder(1000, 5, Side::SELL, OrderType::LIMIT, 100, 106.00, Action::NEW);
+    
+    // Plafond de niveaux : deux niveaux consommés, reliquat annulé, pas de suspension
+    engine->processOrder(1001, 6, Side::BUY, OrderType::MARKET, 400, 0, Action::NEW);
+    EXPECT_EQ(engine->getOrder(6)->getExecutedQuantity(), 200);
+    EXPECT_EQ(engine->getOrder(6)->getStatus(), OrderStatus::CANCELED);
+    EXPECT_FALSE(engine->isHalted());
+    
+    // FOK : 300 croisés mais seulement 200 dans la bande (101 + 2)
+    engine->processOrder(1002, 7, Side::BUY, OrderType::LIMIT, 300, 110.00, Action::NEW,
+                         {0, SelfTradePrevention::NONE, TimeInForce::FOK});
+    EXPECT_EQ(engine->getOrder(7)->getExecutedQuantity(), 0);
+    
+    // Bande atteinte à 106 : arrêt à 103 et suspension
+    engine->processOrder(1003, 8, Side::BUY, OrderType::MARKET, 300, 0, Action::NEW);
+    EXPECT_EQ(engine->getOrder(8)->getExecutedQuantity(), 200);
+    EXPECT_EQ(engine->getOrder(8)->getStatus(), OrderStatus::CANCELED);
+    EXPECT_TRUE(engine->isHalted());
+    EXPECT_EQ(engine->getPhase(), TradingPhase::AUCTION);
+    
+    // Pendant la suspension, un LIMIT croisant s'accumule sans matching
+    engine->processOrder(1100, 9, Side::BUY, OrderType::LIMIT, 50, 106.00, Action::NEW);
+    EXPECT_EQ(engine->getOrder(9)->getExecutedQuantity(), 0);
+    
+    // Premier ordre après la suspension : fixing puis retour au continu
+    engine->processOrder(1503, 10, Side::BUY, OrderType::LIMIT, 10, 90.00, Action::NEW);
+    EXPECT_FALSE(engine->isHalted());
+    EXPECT_EQ(engine->getPhase(), TradingPhase::CONTINUOUS);
+    EXPECT_EQ(engine->getOrder(9)->getStatus(), OrderStatus::EXECUTED);
+}
+
+TEST_F(MatchingEngineTest, EvenementsAgregesEtFluxDeTrades) {
+    engine->setEventMode(EventMode::AGGREGATED);
+    engine->processOrder(1000, 1, Side::SELL, OrderType::LIMIT, 100, 100.00, Action::NEW);
+    engine->processOrder(1000, 2, Side::SELL, OrderType::LIMIT, 50, 100.00, Action::NEW);
+    engine->processOrder(1000, 3, Side::SELL, OrderType::LIMIT, 100, 101.00, Action::NEW);
+    size_t before = engine->getEvents().size();
+    
+    // Trois fills passifs, deux résumés de l'agresseur (un par niveau)
+    engine->processOrder(1001, 4, Side::BUY, OrderType::MARKET, 250, 0, Action::NEW);
+    const auto& events = engine->getEvents();
+    ASSERT_EQ(events.size() - before, 5u);
+    const OrderEvent& firstLevel = events[before + 2];
+    EXPECT_EQ(firstLevel.orderId, 4);
+    EXPECT_EQ(firstLevel.executedQuantity, 150);
+    EXPECT_DOUBLE_EQ(firstLevel.executionPrice, 100.00);
+    EXPECT_EQ(firstLevel.counterpartyId, 0);
+    const OrderEvent& secondLevel = events.back();
+    EXPECT_EQ(secondLevel.orderId, 4);
+    EXPECT_EQ(secondLevel.status, OrderStatus::EXECUTED);
+    EXPECT_EQ(secondLevel.executedQuantity, 100);
+    EXPECT_EQ(secondLevel.counterpartyId, 3);
+    EXPECT_EQ(events[before + 3].orderId, 3);
+    
+    // TRADES : aucun événement d'exécution, un enregistrement par trade
+    engine->setEventMode(EventMode::TRADES);
+    engine->processOrder(1002, 5, Side::BUY, OrderType::LIMIT, 100, 102.00, Action::NEW);
+    engine->processOrder(1003, 6, Side::SELL, OrderType::LIMIT, 60, 102.00, Action::NEW);
+    EXPECT_EQ(engine->getEvents().back().orderId, 5);
+    ASSERT_EQ(engine->getTrades().size(), 1u);
+    const Trade& trade = engine->getTrades().front();
+    EXPECT_EQ(trade.timestamp, 1003u);
+    EXPECT_EQ(trade.buyOrderId, 5);
+    EXPECT_EQ(trade.sellOrderId, 6);
+    EXPECT_EQ(trade.aggressorId, 6);
+    EXPECT_EQ(trade.quantity, 60);
+}
+
 TEST_F(MatchingEngineTest, CancelPartiallyExecutedOrder) {
     // Créer un ordre SELL de 50
     engine->processOrder(1000, 1, Side::SELL, OrderType::LIMIT, 50, 150.00, Action::NEW);
@@ -165,4 +416,255 @@ TEST_F(MatchingEngineTest, CancelPartiallyExecutedOrder) {
     // L'ordre ne devrait plus être dans le carnet
     auto orderInBook = engine->getOrderBook().findOrder(2);
     EXPECT_EQ(orderInBook, nullptr);
-}
\ No newline at end of file
+}
+TEST_F(MatchingEngineTest, AutoExecutionCancelBothEvenements) {
+    engine->processOrder(1000, 1, Side::SELL, OrderType::LIMIT, 100, 150.00, Action::NEW,
+                         {42, SelfTradePrevention::NONE});
+    engine->processOrder(1001, 2, Side::BUY, OrderType::LIMIT, 100, 150.00, Action::NEW,
+                         {42, SelfTradePrevention::CANCEL_BOTH});
+    
+    auto& events = engine->getEvents();
+    ASSERT_EQ(events.size(), 3);
+    
+    // Aucun trade : l'ordre au repos et l'ordre entrant sont annulés
+    auto resting = findEvent(events, 1, OrderStatus::CANCELED);
+    ASSERT_NE(resting, nullptr);
+    EXPECT_EQ(resting->actionTimestamp, 1001);
+    EXPECT_EQ(resting->displayQuantity, 0);
+    ASSERT_NE(findEvent(events, 2, OrderStatus::CANCELED), nullptr);
+    EXPECT_EQ(engine->getOrderBook().getOrderCount(), 0);
+    
+    // Un autre compte matche normalement
+    engine->processOrder(1002, 3, Side::SELL, OrderType::LIMIT, 100, 150.00, Action::NEW,
+                         {42, SelfTradePrevention::NONE});
+    engine->processOrder(1003, 4, Side::BUY, OrderType::LIMIT, 100, 150.00, Action::NEW,
+                         {43, SelfTradePrevention::CANCEL_BOTH});
+    EXPECT_NE(findEvent(engine->getEvents(), 4, OrderStatus::EXECUTED), nullptr);
+}
+
+TEST_F(MatchingEngineTest, TimeInForceIocEtFok) {
+    engine->processOrder(1000, 1, Side::SELL, OrderType::LIMIT, 100, 150.00, Action::NEW);
+    engine->processOrder(1001, 2, Side::SELL, OrderType::LIMIT, 100, 151.00, Action::NEW);
+    
+    // IOC : 100 exécutés à 150, le reliquat est annulé au lieu de rester au carnet
+    engine->processOrder(1002, 3, Side::BUY, OrderType::LIMIT, 150, 150.00, Action::NEW,
+                         {0, SelfTradePrevention::NONE, TimeInForce::IOC});
+    auto ioc = engine->getOrder(3);
+    EXPECT_EQ(ioc->getExecutedQuantity(), 100);
+    EXPECT_EQ(ioc->getStatus(), OrderStatus::CANCELED);
+    EXPECT_EQ(engine->getOrderBook().findOrder(3), nullptr);
+    EXPECT_NE(findEvent(engine->getEvents(), 3, OrderStatus::CANCELED), nullptr);
+    
+    // FOK non exécutable (100 disponibles à 151) : annulé, carnet intact
+    engine->processOrder(1003, 4, Side::BUY, OrderType::LIMIT, 120, 151.00, Action::NEW,
+                         {0, SelfTradePrevention::NONE, TimeInForce::FOK});
+    EXPECT_EQ(engine->getOrder(4)->getExecutedQuantity(), 0);
+    EXPECT_EQ(engine->getOrder(4)->getStatus(), OrderStatus::CANCELED);
+    EXPECT_EQ(engine->getOrder(2)->getRemainingQuantity(), 100);
+    
+    // FOK exécutable : entièrement exécuté
+    engine->processOrder(1004, 5, Side::BUY, OrderType::LIMIT, 60, 151.00, Action::NEW,
+                         {0, SelfTradePrevention::NONE, TimeInForce::FOK});
+    EXPECT_EQ(engine->getOrder(5)->getStatus(), OrderStatus::EXECUTED);
+    
+    // La quantité agrégée du niveau suit le fill partiel : 40 restants
+    engine->processOrder(1005, 6, Side::BUY, OrderType::LIMIT, 41, 151.00, Action::NEW,
+                         {0, SelfTradePrevention::NONE, TimeInForce::FOK});
+    EXPECT_EQ(engine->getOrder(6)->getStatus(), OrderStatus::CANCELED);
+    EXPECT_EQ(engine->getOrderBook().getAsks().getBestLevel()->getTotalQuantity(), 40);
+}
+
+TEST_F(MatchingEngineTest, OrdresDayExpirentAuChangementDeJour) {
+    const Timestamp day = 86'400'000'000'000ULL;
+    engine->processOrder(day + 1, 1, Side::BUY, OrderType::LIMIT, 100, 150.00, Action::NEW,
+                         {0, SelfTradePrevention::NONE, TimeInForce::DAY});
+    engine->processOrder(day + 2, 2, Side::BUY, OrderType::LIMIT, 100, 149.00, Action::NEW);
+    engine->processOrder(2 * day - 1, 3, Side::BUY, OrderType::LIMIT, 100, 148.00, Action::NEW);
+    EXPECT_NE(engine->getOrderBook().findOrder(1), nullptr);
+    
+    // Premier ordre du jour suivant : l'ordre DAY expire, le GTC reste
+    engine->processOrder(2 * day + 5, 4, Side::SELL, OrderType::LIMIT, 100, 160.00, Action::NEW);
+    EXPECT_EQ(engine->getOrderBook().findOrder(1), nullptr);
+    EXPECT_NE(engine->getOrderBook().findOrder(2), nullptr);
+    
+    auto expired = findEvent(engine->getEvents(), 1, OrderStatus::CANCELED);
+    ASSERT_NE(expired, nullptr);
+    EXPECT_EQ(expired->action, Action::CANCEL);
+    EXPECT_EQ(expired->actionTimestamp, 2 * day);
+}
+
+TEST_F(MatchingEngineTest, OrdresStopDeclenchementEnCascade) {
+    engine->processOrder(1000, 1, Side::BUY, OrderType::LIMIT, 100, 99.00, Action::NEW);
+    engine->processOrder(1001, 2, Side::BUY, OrderType::LIMIT, 100, 98.00, Action::NEW);
+    engine->processOrder(1002, 3, Side::BUY, OrderType::LIMIT, 100, 97.00, Action::NEW);
+    
+    // Stop au marché à 99, stop-limit 96 déclenché à 98, stop lointain à 90
+    OrderOptions stop99, stop98, stop90;
+    stop99.stopPrice = 99.00;
+    stop98.stopPrice = 98.00;
+    stop90.stopPrice = 90.00;
+    engine->processOrder(1003, 10, Side::SELL, OrderType::MARKET, 100, 0, Action::NEW, stop99);
+    engine->processOrder(1004, 11, Side::SELL, OrderType::LIMIT, 100, 96.00, Action::NEW, stop98);
+    engine->processOrder(1005, 12, Side::SELL, OrderType::MARKET, 50, 0, Action::NEW, stop90);
+    EXPECT_NE(findEvent(engine->getEvents(), 10, OrderStatus::PENDING), nullptr);
+    EXPECT_EQ(engine->getOrderBook().getStops().getOrderCount(), 3);
+    EXPECT_EQ(engine->getOrderBook().getBestBid(), 99.00);
+    
+    // Le trade à 99 déclenche #10, qui traite à 98 et déclenche #11
+    engine->processOrder(1006, 20, Side::SELL, OrderType::LIMIT, 100, 99.00, Action::NEW);
+    
+    auto stopMarket = findEvent(engine->getEvents(), 10, OrderStatus::EXECUTED);
+    ASSERT_NE(stopMarket, nullptr);
+    EXPECT_EQ(stopMarket->counterpartyId, 2);
+    EXPECT_DOUBLE_EQ(stopMarket->executionPrice, 98.00);
+    auto stopLimit = findEvent(engine->getEvents(), 11, OrderStatus::EXECUTED);
+    ASSERT_NE(stopLimit, nullptr);
+    EXPECT_EQ(stopLimit->counterpartyId, 3);
+    EXPECT_DOUBLE_EQ(stopLimit->executionPrice, 97.00);
+    EXPECT_TRUE(engine->getOrderBook().getBids().isEmpty());
+    EXPECT_DOUBLE_EQ(engine->getOrderBook().getLastTradePrice(), 97.00);
+    
+    // Le stop non atteint reste annulable
+    EXPECT_EQ(engine->getOrderBook().getStops().getOrderCount(), 1);
+    engine->processOrder(1007, 12, Side::SELL, OrderType::MARKET, 0, 0, Action::CANCEL);
+    EXPECT_TRUE(engine->getOrderBook().getStops().isEmpty());
+    EXPECT_EQ(engine->getOrder(12)->getStatus(), OrderStatus::CANCELED);
+}
+
+TEST_F(MatchingEngineTest, EnchereAccumulationPuisFixing) {
+    engine->startAuction();
+    engine->processOrder(1000, 1, Side::BUY, OrderType::LIMIT, 100, 101.00, Action::NEW);
+    engine->processOrder(1001, 2, Side::SELL, OrderType::LIMIT, 60, 99.00, Action::NEW);
+    engine->processOrder(1002, 3, Side::SELL, OrderType::LIMIT, 60, 100.00, Action::NEW);
+    
+    // Les ordres croisés s'accumulent sans exécution
+    EXPECT_EQ(findEvent(engine->getEvents(), 1, OrderStatus::EXECUTED), nullptr);
+    EXPECT_EQ(engine->getOrderBook().getOrderCount(), 3);
+    EXPECT_EQ(engine->processOrder(1003, 4, Side::BUY, OrderType::MARKET, 10, 0, Action::NEW),
+              OrderRejection::AUCTION_PHASE);
+    
+    // Volume 100 à 100 (60 + 40), contre 60 à 99
+    AuctionResult result = engine->uncross(2000);
+    EXPECT_DOUBLE_EQ(result.price, 100.00);
+    EXPECT_EQ(result.volume, 100);
+    EXPECT_EQ(engine->getPhase(), TradingPhase::CONTINUOUS);
+    
+    auto buy = findEvent(engine->getEvents(), 1, OrderStatus::EXECUTED);
+    ASSERT_NE(buy, nullptr);
+    EXPECT_EQ(buy->actionTimestamp, 2000);
+    EXPECT_DOUBLE_EQ(buy->executionPrice, 100.00);
+    EXPECT_EQ(engine->getOrder(3)->getRemainingQuantity(), 20);
+    
+    // Retour au continu : un ordre entrant matche immédiatement
+    engine->processOrder(2001, 5, Side::BUY, OrderType::LIMIT, 20, 100.00, Action::NEW);
+    EXPECT_NE(findEvent(engine->getEvents(), 5, OrderStatus::EXECUTED), nullptr);
+}
+
+TEST(InstrumentManagerAuctionTest, FixingParalleleIdentiqueAuSequentiel) {
+    auto fill = [](InstrumentManager& manager) {
+        manager.startAuction();
+        for (int s = 0; s < 50; ++s) {
+            std::string symbol = "SYM" + std::to_string(s);
+            OrderId base = static_cast<OrderId>(s) * 100 + 1;
+            for (int k = 0; k < 10; ++k) {
+                manager.processOrder(1000 + k, base + k, symbol, Side::BUY, OrderType::LIMIT,
+                                     10 + k, 100.0 + k % 4, Action::NEW);
+                manager.processOrder(1000 + k, base + 50 + k, symbol, Side::SELL, OrderType::LIMIT,
+                                     12 + k, 99.0 + k % 5, Action::NEW);
+            }
+        }
+    };
+    
+    InstrumentManager sequential;
+    fill(sequential);
+    Quantity sequentialVolume = sequential.uncrossAll(5000);
+    
+    InstrumentManager parallel;
+    fill(parallel);
+    ThreadPool pool(4);
+    Quantity parallelVolume = parallel.uncrossAll(5000, &pool);
+    
+    EXPECT_GT(sequentialVolume, 0);
+    EXPECT_EQ(parallelVolume, sequentialVolume);
+    EXPECT_FALSE(parallel.isInAuction());
+    
+    auto expected = sequential.getAllEvents();
+    auto actual = parallel.getAllEvents();
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(actual[i].orderId, expected[i].orderId);
+        EXPECT_EQ(actual[i].status, expected[i].status);
+        EXPECT_EQ(actual[i].executedQuantity, expected[i].executedQuantity);
+        EXPECT_DOUBLE_EQ(actual[i].executionPrice, expected[i].executionPrice);
+    }
+}
+
+TEST(MatchingEngineMemoryTest, AllocationsDansLaMemoryResourceFournie) {
+    // Arène monotone sans upstream : toute allocation hors arène échoue
+    std::vector<std::byte> buffer(1 << 20);
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                              std::pmr::null_memory_resource());
+    auto* previous = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+    
+    {
+        MatchingEngine engine("AAPL", &arena);
+        EXPECT_EQ(engine.getMemoryResource(), &arena);
+        
+        EXPECT_NO_THROW({
+            engine.processOrder(1000, 1, Side::SELL, OrderType::LIMIT, 100, 150.00, Action::NEW);
+            engine.processOrder(1001, 2, Side::SELL, OrderType::LIMIT, 100, 151.00, Action::NEW);
+            engine.processOrder(1002, 3, Side::BUY, OrderType::LIMIT, 150, 151.00, Action::NEW);
+            engine.processOrder(1003, 4, Side::BUY, OrderType::LIMIT, 100, 149.00, Action::NEW);
+            engine.processOrder(1004, 4, Side::BUY, OrderType::LIMIT, 80, 148.00, Action::MODIFY);
+            engine.processOrder(1005, 2, Side::SELL, OrderType::LIMIT, 0, 0, Action::CANCEL);
+            engine.processOrder(1006, 5, Side::SELL, OrderType::MARKET, 50, 0, Action::NEW);
+        });
+        
+        EXPECT_EQ(engine.getEvents().size(), 11);
+        EXPECT_EQ(engine.getOrder(4)->getRemainingQuantity(), 30);
+    }
+    
+    std::pmr::set_default_resource(previous);
+}
+
+TEST(EngineMetricsTest, CompteursJaugesEtExportPrometheus) {
+    InstrumentManager manager;
+    manager.processOrder(1000, 1, "AAPL", Side::SELL, OrderType::LIMIT, 100, 150.00, Action::NEW);
+    manager.processOrder(1001, 2, "AAPL", Side::SELL, OrderType::LIMIT, 100, 151.00, Action::NEW);
+    manager.processOrder(1002, 3, "AAPL", Side::BUY, OrderType::LIMIT, 50, 149.00, Action::NEW);
+    manager.processOrder(1003, 4, "AAPL", Side::BUY, OrderType::LIMIT, 150, 151.00, Action::NEW);
+    manager.processOrder(1004, 3, "AAPL", Side::BUY, OrderType::LIMIT, 40, 149.00, Action::MODIFY);
+    manager.processOrder(1005, 99, "AAPL", Side::BUY, OrderType::LIMIT, 0, 0, Action::CANCEL);
+    manager.processOrder(1006, 5, "MSFT", Side::BUY, OrderType::LIMIT, 10, 300.00, Action::NEW);
+    
+    std::vector<std::pair<std::string, const EngineMetrics*>> seen;
+    manager.forEachMetrics([&](std::string_view instrument, const EngineMetrics& metrics) {
+        seen.emplace_back(std::string(instrument), &metrics);
+    });
+    ASSERT_EQ(seen.size(), 2);
+    const EngineMetrics& aapl = *(seen[0].first == "AAPL" ? seen[0].second : seen[1].second);
+    
+    EXPECT_EQ(aapl.ordersByAction[static_cast<size_t>(Action::NEW)].get(), 4);
+    EXPECT_EQ(aapl.ordersByAction[static_cast<size_t>(Action::MODIFY)].get(), 1);
+    EXPECT_EQ(aapl.ordersByAction[static_cast<size_t>(Action::CANCEL)].get(), 1);
+    EXPECT_EQ(aapl.fills.get(), 2);      // Ordre 4 contre 1 puis 2
+    EXPECT_EQ(aapl.rejects.get(), 1);    // Annulation d'un ordre inconnu
+    EXPECT_EQ(aapl.restingOrders.get(), 2);
+    EXPECT_EQ(aapl.bidLevels.get(), 1);
+    EXPECT_EQ(aapl.askLevels.get(), 1);
+    EXPECT_EQ(aapl.historySize.get(), 4);
+    
+    PipelineMetrics pipeline;
+    pipeline.inputLines.set(7);
+    pipeline.processLatency.record(3);      // Seau [2, 4) ns
+    pipeline.processLatency.record(1000);   // Seau [512, 1024) ns
+    
+    std::string text = MetricsExporter::render(manager, pipeline);
+    EXPECT_NE(text.find("# TYPE matching_engine_orders_total counter"), std::string::npos);
+    EXPECT_NE(text.find("matching_engine_orders_total{instrument=\"AAPL\",action=\"NEW\"} 4"), std::string::npos);
+    EXPECT_NE(text.find("matching_engine_fills_total{instrument=\"AAPL\"} 2"), std::string::npos);
+    EXPECT_NE(text.find("matching_engine_price_levels{instrument=\"MSFT\",side=\"SELL\"} 0"), std::string::npos);
+    EXPECT_NE(text.find("matching_engine_input_lines_total 7"), std::string::npos);
+    EXPECT_NE(text.find("matching_engine_process_latency_seconds_count 2"), std::string::npos);
+    EXPECT_NE(text.find("matching_engine_process_latency_seconds_bucket{le=\"+Inf\"} 2"), std::string::npos);
+}
@@ -0,0 +1,131 @@
+// ===== tests/test_NumaTopology.cpp =====
+#include <gtest/gtest.h>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include "utils/HugePageArena.hpp"
+#include "utils/NumaTopology.hpp"
+#include "utils/ThreadPool.hpp"
+
+namespace {
+    size_t affinityCount() {
+        return NumaTopology::currentAffinity().size();
+    }
+}
+
+class NumaTopologyTest : public ::testing::Test {
+protected:
+    std::filesystem::path root = std::filesystem::temp_directory_path() / "test_numa_sysfs";
+    
+    void SetUp() override {
+        // Machine à deux nœuds de deux CPU
+        std::filesystem::create_directories(root / "node0");
+        std::filesystem::create_directories(root / "node1");
+        write("online", "0-1\n");
+        write("node0/cpulist", "0-1\n");
+        write("node1/cpulist", "2-3\n");
+        write("node0/meminfo", "Node 0 MemTotal:       2097152 kB\nNode 0 MemFree:        1048576 kB\n");
+        write("node1/meminfo", "Node 1 MemTotal:       1048576 kB\n");
+        write("node0/distance", "10 21\n");
+        write("node1/distance", "21 10\n");
+    }
+    
+    void TearDown() override {
+        std::filesystem::remove_all(root);
+    }
+    
+    void write(const std::string& name, const std::string& content) {
+        std::ofstream file(root / name);
+        file << content;
+    }
+};
+
+TEST_F(NumaTopologyTest, LectureSysfsEtRepartitionDesWorkers) {
+    EXPECT_EQ(NumaTopology::parseCpuList("0-3,8,10-11"), (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    
+    NumaTopology topology(root.string(), {0, 1, 2, 3});
+    ASSERT_EQ(topology.getNodes().size(), 2u);
+    EXPECT_TRUE(topology.isNuma());
+    EXPECT_EQ(topology.getNodes()[0].memoryBytes, 2ull << 30);
+    EXPECT_EQ(topology.getNodes()[1].distances, (std::vector<int>{21, 10}));
+    EXPECT_EQ(topology.nodeOfCpu(3), 1);
+    EXPECT_EQ(topology.nodeOfCpu(7), -1);
+    
+    // Workers successifs sur des nœuds alternés
+    EXPECT_EQ(topology.cpuForWorker(0), 0);
+    EXPECT_EQ(topology.cpuForWorker(1), 2);
+    EXPECT_EQ(topology.cpuForWorker(2), 1);
+    EXPECT_EQ(topology.cpuForWorker(3), 3);
+    EXPECT_EQ(topology.cpuForWorker(4), 0);
+    
+    std::ostringstream report;
+    topology.report(report);
+    EXPECT_NE(report.str().find("Node 1: 2 CPUs (2-3), memory 1024 MB, distances 21 10"), std::string::npos);
+    
+    // CPU hors de l'affinité du processus écartés
+    NumaTopology restricted(root.string(), {0, 1, 3});
+    EXPECT_EQ(restricted.getNodes()[1].cpus, (std::vector<int>{3}));
+    EXPECT_EQ(restricted.cpuForWorker(2), 1);
+    
+    // Sans sysfs : un seul nœud
+    NumaTopology flat((root / "absent").string(), {0, 1});
+    ASSERT_EQ(flat.getNodes().size(), 1u);
+    EXPECT_FALSE(flat.isNuma());
+    EXPECT_EQ(flat.getNodes()[0].cpus.size(), 2u);
+}
+
+TEST(NumaPlacementTest, WorkersPlacesEtMemoireLiee) {
+    const NumaTopology& topology = NumaTopology::get();
+    ASSERT_FALSE(topology.getNodes().empty());
+    const NumaNode& node = topology.getNodes()[0];
+    
+    // SPREAD : un cœur par worker ; tout le travail est fait malgré le vol limité au nœud
+    std::atomic<size_t> executed{0};
+    std::atomic<size_t> misplaced{0};
+    {
+        ThreadPool pool(3, ThreadPlacement::spread());
+        for (size_t i = 0; i < 3; ++i) {
+            EXPECT_EQ(pool.getWorkerNode(i), topology.nodeOfCpu(topology.cpuForWorker(i)));
+        }
+        for (int i = 0; i < 200; ++i) {
+            pool.submit([&] {
+                if (affinityCount() != 1) misplaced++;
+                executed++;
+            });
+        }
+        pool.wait();
+    }
+    EXPECT_EQ(executed.load(), 200u);
+    EXPECT_EQ(misplaced.load(), 0u);
+    
+    // NODE : tous les cœurs du nœud
+    {
+        ThreadPool pool(2, ThreadPlacement::onNode(node.id));
+        for (int i = 0; i < 20; ++i) {
+            pool.submit([&] {
+                if (affinityCount() != node.cpus.size()) misplaced++;
+            });
+        }
+        pool.wait();
+        EXPECT_EQ(pool.getWorkerNode(1), node.id);
+    }
+    EXPECT_EQ(misplaced.load(), 0u);
+    
+    // Thread fixé d'emblée sur le nœud de son CPU courant
+    std::thread([&] {
+        int cpu = -1;
+        int pinned = topology.pinToCurrentNode(cpu);
+        EXPECT_EQ(pinned, topology.nodeOfCpu(cpu));
+        ASSERT_NE(topology.findNode(pinned), nullptr);
+        EXPECT_EQ(NumaTopology::currentAffinity(), topology.findNode(pinned)->cpus);
+    }).join();
+    
+    // Arène liée au nœud avant d'être touchée
+    HugePageArena arena(1 << 20, false, std::pmr::new_delete_resource(), node.id);
+    EXPECT_NE(arena.getBacking(), HugePageArena::Backing::NONE);
+    void* block = arena.allocate(4096);
+    EXPECT_NE(block, nullptr);
+    EXPECT_EQ(arena.getOverflowAllocations(), 0u);
+}
@@ -150,4 +150,311 @@ TEST_F(OrderMatcherTest, MarketOrderReliquatAnnule) {
     EXPECT_EQ(marketBuy->getStatus(), OrderStatus::CANCELED);
     EXPECT_EQ(marketBuy->getExecutedQuantity(), 100);
     EXPECT_EQ(marketBuy->getRemainingQuantity(), 100);
-}
\ No newline at end of file
+}
+TEST_F(OrderMatcherTest, BalayageNiveauProfondAvecAnnulations) {
+    // 100 petits ordres SELL au même prix, dont un sur trois est annulé
+    for (OrderId id = 1; id <= 100; ++id) {
+        book->addOrder(createOrder(id, Side::SELL, OrderType::LIMIT, 10, 150.00));
+    }
+    for (OrderId id = 3; id <= 100; id += 3) {
+        book->removeOrder(id);
+    }
+    
+    PriceLevel* level = book->getAsks().getBestLevel();
+    ASSERT_NE(level, nullptr);
+    EXPECT_EQ(level->getOrderCount(), 67);
+    EXPECT_EQ(level->getTotalQuantity(), 670);
+    
+    // Consomme 40 ordres entiers puis 5 unités du suivant
+    auto buy = createOrder(200, Side::BUY, OrderType::LIMIT, 405, 150.00);
+    auto trades = OrderMatcher::matchOrder(buy, *book);
+    
+    ASSERT_EQ(trades.size(), 41);
+    for (const auto& trade : trades) {
+        EXPECT_NE(trade.sellOrderId % 3, 0); // Aucun ordre annulé ne trade
+    }
+    EXPECT_EQ(trades.back().quantity, 5);
+    EXPECT_EQ(buy->getStatus(), OrderStatus::EXECUTED);
+    
+    // Le niveau conserve la priorité temps et des agrégats cohérents
+    EXPECT_EQ(level->getOrderCount(), 27);
+    EXPECT_EQ(level->getTotalQuantity(), 265);
+    EXPECT_EQ(level->getFrontOrder()->getOrderId(), trades.back().sellOrderId);
+    EXPECT_EQ(book->findOrder(trades.front().sellOrderId), nullptr);
+}
+
+TEST_F(OrderMatcherTest, AutoExecutionCancelOldestEtNewest) {
+    // Asks @150 : #1 (autre compte), #2 (compte 7), #3 (autre compte)
+    auto sell1 = createOrder(1, Side::SELL, OrderType::LIMIT, 100, 150.00);
+    auto sell2 = createOrder(2, Side::SELL, OrderType::LIMIT, 100, 150.00);
+    auto sell3 = createOrder(3, Side::SELL, OrderType::LIMIT, 100, 150.00);
+    sell2->setOptions({7, SelfTradePrevention::NONE});
+    book->addOrder(sell1);
+    book->addOrder(sell2);
+    book->addOrder(sell3);
+    
+    // CANCEL_OLDEST : #2 est annulé, le matching continue sur #3
+    auto buy = createOrder(10, Side::BUY, OrderType::LIMIT, 150, 150.00);
+    buy->setOptions({7, SelfTradePrevention::CANCEL_OLDEST});
+    std::pmr::vector<Trade> trades;
+    std::pmr::vector<OrderPtr> adjusted;
+    OrderMatcher::matchOrder(buy, *book, trades, &adjusted);
+    
+    ASSERT_EQ(trades.size(), 2);
+    EXPECT_EQ(trades[0].sellOrderId, 1);
+    EXPECT_EQ(trades[1].sellOrderId, 3);
+    EXPECT_EQ(trades[1].quantity, 50);
+    ASSERT_EQ(adjusted.size(), 1);
+    EXPECT_EQ(adjusted[0]->getOrderId(), 2);
+    EXPECT_EQ(sell2->getStatus(), OrderStatus::CANCELED);
+    EXPECT_EQ(book->findOrder(2), nullptr);
+    EXPECT_EQ(buy->getStatus(), OrderStatus::EXECUTED);
+    EXPECT_EQ(book->getAsks().getBestLevel()->getTotalQuantity(), 50);
+    
+    // CANCEL_NEWEST : l'ordre entrant s'arrête devant un ordre du même compte
+    auto sell4 = createOrder(4, Side::SELL, OrderType::LIMIT, 100, 150.00);
+    sell4->setOptions({8, SelfTradePrevention::NONE});
+    book->addOrder(sell4);
+    auto buy2 = createOrder(11, Side::BUY, OrderType::LIMIT, 200, 151.00);
+    buy2->setOptions({8, SelfTradePrevention::CANCEL_NEWEST});
+    trades.clear();
+    adjusted.clear();
+    OrderMatcher::matchOrder(buy2, *book, trades, &adjusted);
+    
+    ASSERT_EQ(trades.size(), 1);
+    EXPECT_EQ(trades[0].sellOrderId, 3);
+    EXPECT_EQ(buy2->getExecutedQuantity(), 50);
+    EXPECT_EQ(buy2->getStatus(), OrderStatus::CANCELED);
+    EXPECT_TRUE(adjusted.empty());
+    EXPECT_EQ(book->findOrder(11), nullptr);     // Pas de reliquat au repos
+    EXPECT_NE(book->findOrder(4), nullptr);      // L'ordre au repos est intact
+}
+
+TEST_F(OrderMatcherTest, AutoExecutionAgresseurPlusGrandQueLeNiveau) {
+    // Niveaux @150 et @151 entièrement consommés par un ordre entrant avec STP
+    auto sell1 = createOrder(1, Side::SELL, OrderType::LIMIT, 10, 150.00);
+    auto sell2 = createOrder(2, Side::SELL, OrderType::LIMIT, 20, 150.00);
+    auto sell3 = createOrder(3, Side::SELL, OrderType::LIMIT, 10, 151.00);
+    sell1->setOptions({2, SelfTradePrevention::NONE});
+    sell2->setOptions({2, SelfTradePrevention::NONE});
+    sell3->setOptions({3, SelfTradePrevention::NONE});
+    book->addOrder(sell1);
+    book->addOrder(sell2);
+    book->addOrder(sell3);
+    
+    auto buy = createOrder(10, Side::BUY, OrderType::LIMIT, 50, 151.00);
+    buy->setOptions({1, SelfTradePrevention::CANCEL_NEWEST});
+    std::pmr::vector<Trade> trades;
+    std::pmr::vector<OrderPtr> adjusted;
+    OrderMatcher::matchOrder(buy, *book, trades, &adjusted);
+    
+    ASSERT_EQ(trades.size(), 3);
+    EXPECT_EQ(trades[2].sellOrderId, 3);
+    EXPECT_EQ(buy->getExecutedQuantity(), 40);
+    EXPECT_EQ(buy->getRemainingQuantity(), 10);
+    EXPECT_TRUE(adjusted.empty());
+    EXPECT_TRUE(book->getAsks().isEmpty());
+}
+
+TEST_F(OrderMatcherTest, AutoExecutionDecrementAndCancel) {
+    auto sell1 = createOrder(1, Side::SELL, OrderType::LIMIT, 300, 150.00);
+    auto sell2 = createOrder(2, Side::SELL, OrderType::LIMIT, 100, 150.00);
+    sell1->setOptions({5, SelfTradePrevention::NONE});
+    book->addOrder(sell1);
+    book->addOrder(sell2);
+    
+    // Ordre entrant plus petit : il est annulé, l'ordre au repos réduit d'autant
+    auto buy = createOrder(10, Side::BUY, OrderType::LIMIT, 120, 150.00);
+    buy->setOptions({5, SelfTradePrevention::DECREMENT_AND_CANCEL});
+    std::pmr::vector<Trade> trades;
+    std::pmr::vector<OrderPtr> adjusted;
+    OrderMatcher::matchOrder(buy, *book, trades, &adjusted);
+    
+    EXPECT_TRUE(trades.empty());
+    EXPECT_EQ(buy->getStatus(), OrderStatus::CANCELED);
+    EXPECT_EQ(buy->getRemainingQuantity(), 0);
+    ASSERT_EQ(adjusted.size(), 1);
+    EXPECT_EQ(sell1->getRemainingQuantity(), 180);
+    EXPECT_EQ(sell1->getStatus(), OrderStatus::PENDING);
+    EXPECT_EQ(book->getAsks().getBestLevel()->getTotalQuantity(), 280);
+    
+    // Ordre entrant plus grand : l'ordre au repos est annulé, le reste matche #2
+    auto buy2 = createOrder(11, Side::BUY, OrderType::LIMIT, 250, 150.00);
+    buy2->setOptions({5, SelfTradePrevention::DECREMENT_AND_CANCEL});
+    trades.clear();
+    adjusted.clear();
+    OrderMatcher::matchOrder(buy2, *book, trades, &adjusted);
+    
+    ASSERT_EQ(trades.size(), 1);
+    EXPECT_EQ(trades[0].sellOrderId, 2);
+    EXPECT_EQ(trades[0].quantity, 70);
+    EXPECT_EQ(sell1->getStatus(), OrderStatus::CANCELED);
+    // Quantité réduite de 180 : les 70 restants sont entièrement exécutés
+    EXPECT_EQ(buy2->getStatus(), OrderStatus::EXECUTED);
+    EXPECT_EQ(buy2->getQuantity(), 70);
+    EXPECT_EQ(buy2->getRemainingQuantity(), 0);
+    EXPECT_EQ(book->getAsks().getBestLevel()->getTotalQuantity(), 30);
+}
+
+TEST_F(OrderMatcherTest, IcebergReapprovisionneEnFinDeFile) {
+    // Iceberg #1 : 300 dont 100 visibles, puis #2 : 100 au même prix
+    auto sell1 = createOrder(1, Side::SELL, OrderType::LIMIT, 300, 150.00);
+    auto sell2 = createOrder(2, Side::SELL, OrderType::LIMIT, 100, 150.00);
+    sell1->setOptions({0, SelfTradePrevention::NONE, TimeInForce::GTC, 100});
+    book->addOrder(sell1);
+    book->addOrder(sell2);
+    EXPECT_EQ(book->getAsks().getBestLevel()->getTotalQuantity(), 200);
+    
+    // La tranche de #1 épuisée repasse derrière #2
+    auto buy = createOrder(10, Side::BUY, OrderType::LIMIT, 250, 150.00);
+    auto trades = OrderMatcher::matchOrder(buy, *book);
+    
+    ASSERT_EQ(trades.size(), 3);
+    EXPECT_EQ(trades[0].sellOrderId, 1);
+    EXPECT_EQ(trades[0].quantity, 100);
+    EXPECT_EQ(trades[1].sellOrderId, 2);
+    EXPECT_EQ(trades[1].quantity, 100);
+    EXPECT_EQ(trades[2].sellOrderId, 1);
+    EXPECT_EQ(trades[2].quantity, 50);
+    EXPECT_EQ(sell1->getRemainingQuantity(), 150);
+    EXPECT_EQ(sell1->getVisibleQuantity(), 50);
+    EXPECT_EQ(book->findOrder(1), sell1);
+    EXPECT_EQ(book->getAsks().getBestLevel()->getTotalQuantity(), 50);
+    
+    // FOK : la réserve cachée compte dans la quantité exécutable
+    auto fokTooBig = createOrder(11, Side::BUY, OrderType::LIMIT, 151, 150.00);
+    fokTooBig->setOptions({0, SelfTradePrevention::NONE, TimeInForce::FOK});
+    EXPECT_TRUE(OrderMatcher::matchOrder(fokTooBig, *book).empty());
+    EXPECT_EQ(fokTooBig->getStatus(), OrderStatus::CANCELED);
+    
+    auto fok = createOrder(12, Side::BUY, OrderType::LIMIT, 150, 150.00);
+    fok->setOptions({0, SelfTradePrevention::NONE, TimeInForce::FOK});
+    trades = OrderMatcher::matchOrder(fok, *book);
+    ASSERT_EQ(trades.size(), 2);
+    EXPECT_EQ(fok->getStatus(), OrderStatus::EXECUTED);
+    EXPECT_EQ(sell1->getStatus(), OrderStatus::EXECUTED);
+    EXPECT_EQ(book->findOrder(1), nullptr);
+    EXPECT_TRUE(book->getAsks().isEmpty());
+}
+
+TEST_F(OrderMatcherTest, FokAutoExecutionReserveIcebergDerriereLeMemeCompte) {
+    // Iceberg de 100 (10 visibles, compte 1) puis 50 du compte 2
+    auto sell1 = createOrder(1, Side::SELL, OrderType::LIMIT, 100, 150.00);
+    auto sell2 = createOrder(2, Side::SELL, OrderType::LIMIT, 50, 150.00);
+    sell1->setOptions({1, SelfTradePrevention::NONE, TimeInForce::GTC, 10});
+    sell2->setOptions({2, SelfTradePrevention::NONE});
+    book->addOrder(sell1);
+    book->addOrder(sell2);
+    
+    // La réserve de #1 passe derrière #2 : le FOK du compte 2 ne peut avoir que 10
+    auto fok = createOrder(10, Side::BUY, OrderType::LIMIT, 50, 150.00);
+    fok->setOptions({2, SelfTradePrevention::CANCEL_NEWEST, TimeInForce::FOK});
+    EXPECT_TRUE(OrderMatcher::matchOrder(fok, *book).empty());
+    EXPECT_EQ(fok->getStatus(), OrderStatus::CANCELED);
+    EXPECT_EQ(fok->getExecutedQuantity(), 0);
+    EXPECT_EQ(sell1->getRemainingQuantity(), 100);
+    
+    // Sans ordre du même compte derrière, la réserve compte
+    auto fok2 = createOrder(11, Side::BUY, OrderType::LIMIT, 120, 150.00);
+    fok2->setOptions({3, SelfTradePrevention::CANCEL_NEWEST, TimeInForce::FOK});
+    auto trades = OrderMatcher::matchOrder(fok2, *book);
+    EXPECT_EQ(fok2->getStatus(), OrderStatus::EXECUTED);
+    EXPECT_EQ(fok2->getExecutedQuantity(), 120);
+    EXPECT_EQ(sell1->getRemainingQuantity(), 30);
+}
+
+TEST_F(OrderMatcherTest, FixingEnchereVolumeMaximal) {
+    // Carnet croisé accumulé pendant l'enchère
+    book->addOrder(createOrder(1, Side::BUY, OrderType::LIMIT, 100, 101.00));
+    book->addOrder(createOrder(2, Side::BUY, OrderType::LIMIT, 100, 100.00));
+    book->addOrder(createOrder(3, Side::BUY, OrderType::LIMIT, 200, 99.00));
+    book->addOrder(createOrder(4, Side::SELL, OrderType::LIMIT, 150, 98.00));
+    book->addOrder(createOrder(5, Side::SELL, OrderType::LIMIT, 100, 99.00));
+    book->addOrder(createOrder(6, Side::SELL, OrderType::LIMIT, 100, 100.00));
+    
+    // Volumes : 98 -> 150, 99 -> 250, 100 -> 200, 101 -> 100
+    AuctionResult result = OrderMatcher::computeUncross(*book, 0);
+    EXPECT_DOUBLE_EQ(result.price, 99.00);
+    EXPECT_EQ(result.volume, 250);
+    EXPECT_EQ(result.imbalance, 150);
+    
+    std::pmr::vector<Trade> trades;
+    OrderMatcher::uncross(*book, result, trades);
+    
+    ASSERT_EQ(trades.size(), 4);
+    Quantity total = 0;
+    for (const auto& trade : trades) {
+        EXPECT_DOUBLE_EQ(trade.price, 99.00);
+        total += trade.quantity;
+    }
+    EXPECT_EQ(total, 250);
+    EXPECT_EQ(trades[0].buyOrderId, 1);
+    EXPECT_EQ(trades[0].sellOrderId, 4);
+    
+    // Le carnet ne croise plus : reliquat de #3 face à #6
+    EXPECT_DOUBLE_EQ(book->getBestBid(), 99.00);
+    EXPECT_EQ(book->getBids().getBestLevel()->getTotalQuantity(), 150);
+    EXPECT_DOUBLE_EQ(book->getBestAsk(), 100.00);
+    EXPECT_EQ(book->findOrder(1), nullptr);
+    EXPECT_EQ(book->findOrder(5), nullptr);
+    EXPECT_DOUBLE_EQ(book->getLastTradePrice(), 99.00);
+    EXPECT_EQ(OrderMatcher::computeUncross(*book, 0).volume, 0);
+}
+
+TEST_F(OrderMatcherTest, FixingEnchereDepartageParPrixDeReference) {
+    book->addOrder(createOrder(1, Side::BUY, OrderType::LIMIT, 100, 101.00));
+    book->addOrder(createOrder(2, Side::SELL, OrderType::LIMIT, 100, 99.00));
+    
+    // Même volume et même déséquilibre à 99 et 101
+    EXPECT_DOUBLE_EQ(OrderMatcher::computeUncross(*book, 0).price, 99.00);
+    EXPECT_DOUBLE_EQ(OrderMatcher::computeUncross(*book, 100.60).price, 101.00);
+}
+
+TEST_F(OrderMatcherTest, AllocationProRataEtPrioriteTete) {
+    auto fillLevel = [&](OrderId first) {
+        book->addOrder(createOrder(first, Side::SELL, OrderType::LIMIT, 100, 150.00));
+        book->addOrder(createOrder(first + 1, Side::SELL, OrderType::LIMIT, 300, 150.00));
+        book->addOrder(createOrder(first + 2, Side::SELL, OrderType::LIMIT, 600, 150.00));
+    };
+    auto executedBy = [&](const std::pmr::vector<Trade>& trades, OrderId id) {
+        Quantity total = 0;
+        for (const auto& trade : trades) {
+            if (trade.sellOrderId == id) total += trade.quantity;
+        }
+        return total;
+    };
+    
+    // Pro-rata : 33 / 99 / 199 arrondis, reliquat de 2 attribué dans l'ordre de la file
+    // (au premier ordre, dans la limite de sa quantité)
+    book->setAllocationPolicy(AllocationPolicy::PRO_RATA);
+    fillLevel(1);
+    auto buy = createOrder(10, Side::BUY, OrderType::LIMIT, 333, 150.00);
+    auto trades = OrderMatcher::matchOrder(buy, *book);
+    
+    EXPECT_EQ(executedBy(trades, 1), 35);
+    EXPECT_EQ(executedBy(trades, 2), 99);
+    EXPECT_EQ(executedBy(trades, 3), 199);
+    EXPECT_EQ(buy->getStatus(), OrderStatus::EXECUTED);
+    EXPECT_EQ(book->getAsks().getBestLevel()->getTotalQuantity(), 1000 - 333);
+    EXPECT_EQ(book->getAsks().getBestLevel()->getOrderCount(), 3);
+    
+    // Priorité à la tête de file : #4 servi entièrement, 400 au prorata de 300 / 600
+    book = std::make_unique<OrderBook>("AAPL");
+    book->setAllocationPolicy(AllocationPolicy::TOP_PRO_RATA);
+    fillLevel(4);
+    auto buy2 = createOrder(11, Side::BUY, OrderType::LIMIT, 500, 150.00);
+    trades = OrderMatcher::matchOrder(buy2, *book);
+    
+    EXPECT_EQ(executedBy(trades, 4), 100);
+    EXPECT_EQ(executedBy(trades, 5), 134);
+    EXPECT_EQ(executedBy(trades, 6), 266);
+    EXPECT_EQ(book->findOrder(4), nullptr);
+    EXPECT_EQ(book->getAsks().getBestLevel()->getOrderCount(), 2);
+    EXPECT_EQ(book->getAsks().getBestLevel()->getTotalQuantity(), 500);
+    
+    // Un ordre plus grand que le niveau le consomme entièrement
+    auto buy3 = createOrder(12, Side::BUY, OrderType::LIMIT, 600, 150.00);
+    trades = OrderMatcher::matchOrder(buy3, *book);
+    EXPECT_EQ(buy3->getExecutedQuantity(), 500);
+    EXPECT_TRUE(book->getAsks().isEmpty());
+}
@@ -0,0 +1,107 @@
+// ===== tests/test_Snapshot.cpp =====
+#include <gtest/gtest.h>
+#include <cstdio>
+#include "core/InstrumentManager.hpp"
+#include "io/SnapshotReader.hpp"
+#include "io/SnapshotWriter.hpp"
+#include "exceptions/Exceptions.hpp"
+
+class SnapshotTest : public ::testing::Test {
+protected:
+    std::string filename = "test_snapshot.bin";
+    
+    void TearDown() override {
+        std::remove(filename.c_str());
+    }
+};
+
+TEST_F(SnapshotTest, SauvegardeEtRestaurationPrixTemps) {
+    InstrumentManager manager;
+    manager.processOrder(1000, 1, "AAPL", Side::SELL, OrderType::LIMIT, 100, 150.00, Action::NEW);
+    manager.processOrder(1001, 2, "AAPL", Side::SELL, OrderType::LIMIT, 200, 150.00, Action::NEW);
+    manager.processOrder(1002, 3, "AAPL", Side::SELL, OrderType::LIMIT, 300, 151.00, Action::NEW);
+    manager.processOrder(1003, 4, "AAPL", Side::BUY, OrderType::LIMIT, 150, 149.00, Action::NEW);
+    manager.processOrder(1004, 5, "MSFT", Side::BUY, OrderType::LIMIT, 50, 300.00, Action::NEW);
+    // Exécute entièrement #1 et partiellement #2
+    manager.processOrder(1005, 6, "AAPL", Side::BUY, OrderType::MARKET, 130, 0.0, Action::NEW);
+    
+    SnapshotWriter::write(filename, manager, 6);
+    
+    InstrumentManager restored;
+    SnapshotReader reader(filename);
+    EXPECT_EQ(reader.restore(restored), 6);
+    EXPECT_EQ(reader.header().instrumentCount, 2);
+    
+    MatchingEngine& aapl = restored.getOrCreateEngine("AAPL");
+    const OrderBook& book = aapl.getOrderBook();
+    EXPECT_EQ(book.getOrderCount(), 3);
+    EXPECT_DOUBLE_EQ(book.getBestBid(), 149.00);
+    EXPECT_DOUBLE_EQ(book.getBestAsk(), 150.00);
+    
+    // Quantités restantes/exécutées conservées pour l'ordre partiellement exécuté
+    auto order2 = book.findOrder(2);
+    ASSERT_NE(order2, nullptr);
+    EXPECT_EQ(order2->getRemainingQuantity(), 170);
+    EXPECT_EQ(order2->getExecutedQuantity(), 30);
+    EXPECT_EQ(order2->getStatus(), OrderStatus::PARTIALLY_EXECUTED);
+    
+    // Les ordres terminés restent connus : un CANCEL tardif est rejeté comme tel
+    EXPECT_EQ(book.findOrder(1), nullptr);
+    ASSERT_NE(aapl.getOrder(1), nullptr);
+    EXPECT_EQ(restored.processOrder(2000, 1, "AAPL", Side::SELL, OrderType::LIMIT, 0, 0, Action::CANCEL),
+              OrderRejection::ORDER_CLOSED);
+    
+    // La priorité temps est reconstruite : #2 avant #3, puis le reste du niveau 151
+    restored.processOrder(2001, 7, "AAPL", Side::BUY, OrderType::LIMIT, 200, 151.00, Action::NEW);
+    auto events = restored.getAllEvents();
+    std::vector<OrderId> counterparties;
+    for (const auto& event : events) {
+        if (event.orderId == 7 && event.executedQuantity > 0) {
+            counterparties.push_back(event.counterpartyId);
+        }
+    }
+    ASSERT_EQ(counterparties.size(), 2);
+    EXPECT_EQ(counterparties[0], 2);
+    EXPECT_EQ(counterparties[1], 3);
+}
+
+TEST_F(SnapshotTest, SuspensionDeVolatiliteRestauree) {
+    PriceBand band;
+    band.width = 2.00;
+    band.haltDuration = 500;
+    InstrumentManager manager;
+    manager.setPriceBand("AAPL", band);
+    manager.processOrder(1000, 1, "AAPL", Side::SELL, OrderType::LIMIT, 100, 100.00, Action::NEW);
+    manager.processOrder(1000, 2, "AAPL", Side::SELL, OrderType::LIMIT, 100, 105.00, Action::NEW);
+    // Bande atteinte à 105 : suspension jusqu'à 1501, puis un LIMIT croisant s'accumule
+    manager.processOrder(1001, 3, "AAPL", Side::BUY, OrderType::MARKET, 150, 0, Action::NEW);
+    manager.processOrder(1100, 4, "AAPL", Side::BUY, OrderType::LIMIT, 50, 105.00, Action::NEW);
+    ASSERT_TRUE(manager.getOrCreateEngine("AAPL").isHalted());
+    
+    SnapshotWriter::write(filename, manager, 4);
+    InstrumentManager restored;
+    restored.setPriceBand("AAPL", band);
+    SnapshotReader(filename).restore(restored);
+    
+    MatchingEngine& engine = restored.getOrCreateEngine("AAPL");
+    EXPECT_EQ(engine.getPhase(), TradingPhase::AUCTION);
+    EXPECT_EQ(engine.getHaltEnd(), 1501u);
+    EXPECT_EQ(engine.getOrder(4)->getExecutedQuantity(), 0);
+    
+    // Fixing au premier ordre après l'échéance, comme dans la session d'origine
+    manager.processOrder(1600, 5, "AAPL", Side::BUY, OrderType::LIMIT, 10, 90.00, Action::NEW);
+    restored.processOrder(1600, 5, "AAPL", Side::BUY, OrderType::LIMIT, 10, 90.00, Action::NEW);
+    EXPECT_EQ(engine.getPhase(), TradingPhase::CONTINUOUS);
+    EXPECT_EQ(engine.getOrder(4)->getExecutedQuantity(), 50);
+    EXPECT_EQ(engine.getOrderBook().getBestAsk(), manager.getOrCreateEngine("AAPL").getOrderBook().getBestAsk());
+}
+
+TEST_F(SnapshotTest, FichierInvalideRejete) {
+    {
+        std::FILE* file = std::fopen(filename.c_str(), "wb");
+        const char garbage[64] = "not a snapshot";
+        std::fwrite(garbage, 1, sizeof(garbage), file);
+        std::fclose(file);
+    }
+    EXPECT_THROW(SnapshotReader reader(filename), FileIOException);
+}
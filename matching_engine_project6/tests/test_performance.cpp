@@ -3,7 +3,9 @@
 #include <gtest/gtest.h>
 #include <chrono>
 #include <random>
+#include <memory_resource>
 #include "core/InstrumentManager.hpp"
+#include "utils/HugePageArena.hpp"
 #include "utils/TimeUtils.hpp"
 
 class PerformanceTest : public ::testing::Test {
@@ -34,4 +36,69 @@ TEST_F(PerformanceTest, Process100KOrders) {
     EXPECT_LT(duration.count(), 600); // Moins de 10 minutes
     
     std::cout << "Processed 100K orders in " << duration.count() << " seconds\n";
-}
\ No newline at end of file
+}
+
+TEST_F(PerformanceTest, Process100KOrdersPreAlloue) {
+    CapacityConfig capacity;
+    capacity.instruments = 1;
+    capacity.ordersPerBook = 100000;
+    capacity.levelsPerSide = 10000;
+    capacity.useHugePages = true;
+    capacity.symbols = {"AAPL"};
+    
+    // Arène pré-touchée (huge pages si disponibles) sous un pool
+    HugePageArena arena(InstrumentManager::estimateArenaBytes(capacity), capacity.useHugePages);
+    ASSERT_NE(arena.getBacking(), HugePageArena::Backing::NONE);
+    std::pmr::unsynchronized_pool_resource pool(&arena);
+    
+    InstrumentManager manager(&pool);
+    manager.reserve(capacity);
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    
+    for (OrderId id = 1; id <= 100000; ++id) {
+        Side side = sideDist(rng) == 0 ? Side::BUY : Side::SELL;
+        Quantity qty = qtyDist(rng);
+        Price price = priceDist(rng);
+        
+        manager.processOrder(getCurrentTimestamp(), id, "AAPL", side, 
+                           OrderType::LIMIT, qty, price, Action::NEW);
+    }
+    
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+    
+    // L'arène dimensionnée par la configuration suffit : aucun repli sur le tas
+    EXPECT_EQ(arena.getOverflowAllocations(), 0);
+    
+    std::cout << "Processed 100K pre-allocated orders in " << duration.count() << " ms ("
+              << HugePageArena::backingName(arena.getBacking()) << ")\n";
+}
+
+TEST_F(PerformanceTest, AnnulationDeMasse50KOrdres) {
+    InstrumentManager manager;
+    
+    // Carnet non croisé : achats sous 150, ventes au-dessus, deux propriétaires
+    for (OrderId id = 1; id <= 50000; ++id) {
+        Side side = (id % 2 == 0) ? Side::BUY : Side::SELL;
+        Price price = side == Side::BUY ? 100.0 + (id % 500) * 0.1 : 150.1 + (id % 500) * 0.1;
+        OrderOptions options;
+        options.owner = 1 + (id / 2) % 2;
+        manager.processOrder(id, id, "AAPL", side, OrderType::LIMIT, qtyDist(rng), price,
+                             Action::NEW, options);
+    }
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    MassCancelFilter byOwner;
+    byOwner.owner = 1;
+    size_t canceled = manager.massCancel(60000, 0, "AAPL", byOwner);
+    canceled += manager.massCancel(60001, 0, "AAPL", MassCancelFilter{});
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+    
+    EXPECT_EQ(canceled, 50000u);
+    EXPECT_EQ(manager.getOrCreateEngine("AAPL").getOrderBook().getOrderCount(), 0u);
+    EXPECT_LT(duration.count(), 1000);
+    
+    std::cout << "Mass-canceled 50K orders in " << duration.count() << " ms\n";
+}